@@ -0,0 +1,71 @@
+#include "anytime_edit_distance.h"
+#include "dynamic_programming.h"
+#include "greedy_edit_distance.h"
+#include "char_histogram.h"
+#include <algorithm>
+#include <cstdlib>
+
+using namespace std;
+
+AnytimeEditDistance::AnytimeResult AnytimeEditDistance::compute(
+    const string& str1, const string& str2, double budget_ms) {
+    
+    auto budget = chrono::duration_cast<Clock::duration>(chrono::duration<double, milli>(max(0.0, budget_ms)));
+    return compute(str1, str2, Clock::now() + budget);
+}
+
+AnytimeEditDistance::AnytimeResult AnytimeEditDistance::compute(
+    const string& str1, const string& str2, Clock::time_point deadline) {
+    
+    auto start_time = Clock::now();
+    
+    AnytimeResult result;
+    result.band = -1;
+    result.refinements = 0;
+    
+    // 立即可得的上下界：启发式贪心与max(长度差, 直方图距离)
+    result.upper_bound = GreedyEditDistance::heuristicUpperBound(str1, str2);
+    int length_gap = abs((int)str1.length() - (int)str2.length());
+    result.lower_bound = max(length_gap, CharHistogram::bagDistance(CharHistogram(str1), CharHistogram(str2)));
+    
+    // 带状DP的代价约为 较长串长度 * 带宽，用上一轮的实测速度估计下一轮
+    double cells_per_ns = 0.0;
+    int longer = max(str1.length(), str2.length());
+    int band = result.lower_bound;
+    if (band < INITIAL_BAND) {
+        band = INITIAL_BAND;
+    }
+    
+    while (result.lower_bound < result.upper_bound) {
+        // 带宽达到上界-1时这一轮必然得到精确值
+        band = min(band, result.upper_bound - 1);
+        
+        auto now = Clock::now();
+        if (now >= deadline) break;
+        if (cells_per_ns > 0.0) {
+            double remaining_ns = chrono::duration<double, nano>(deadline - now).count();
+            double estimated_ns = (double)longer * (2 * band + 1) / cells_per_ns;
+            if (estimated_ns > remaining_ns) break;
+        }
+        
+        auto round_start = Clock::now();
+        int distance = DynamicProgrammingEditDistance::bitParallelBoundedEditDistance(str1, str2, band);
+        double elapsed_ns = chrono::duration<double, nano>(Clock::now() - round_start).count();
+        cells_per_ns = (double)longer * (2 * band + 1) / max(elapsed_ns, 1.0);
+        
+        result.band = band;
+        result.refinements++;
+        if (distance <= band) {
+            result.upper_bound = distance;
+            result.lower_bound = distance;
+        } else {
+            result.lower_bound = max(result.lower_bound, band + 1);
+        }
+        band *= 2;
+    }
+    
+    result.exact = result.lower_bound == result.upper_bound;
+    result.computation_time = chrono::duration<double, milli>(Clock::now() - start_time).count();
+    
+    return result;
+}
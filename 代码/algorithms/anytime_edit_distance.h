@@ -0,0 +1,42 @@
+#ifndef ANYTIME_EDIT_DISTANCE_H
+#define ANYTIME_EDIT_DISTANCE_H
+
+#include <string>
+#include <chrono>
+
+/**
+ * 限时（anytime）编辑距离 - 立即给出贪心上界，在截止时间前不断细化：
+ * 带宽为k的带状DP若算出不超过k的值即为精确结果，否则证明距离至少为k+1；
+ * 带宽按倍数扩大，直到与上界相接时得到精确结果
+ */
+class AnytimeEditDistance {
+public:
+    using Clock = std::chrono::steady_clock;
+    
+    // 限时计算结果
+    struct AnytimeResult {
+        int upper_bound;          // 已知的最好上界
+        int lower_bound;          // 已证明的下界
+        bool exact;               // 上下界相等，结果为精确值
+        int band;                 // 最后完成的带状DP的带宽，未运行时为-1
+        int refinements;          // 完成的带状DP次数
+        double computation_time;  // 计算时间(ms)
+    };
+
+public:
+    /**
+     * 在budget_ms毫秒内计算，超时前返回当前最好的上下界
+     */
+    static AnytimeResult compute(const std::string& str1, const std::string& str2, double budget_ms);
+    
+    /**
+     * 在deadline之前计算；每一轮根据上一轮的速度估计本轮耗时，来不及完成时不再开始
+     */
+    static AnytimeResult compute(const std::string& str1, const std::string& str2, Clock::time_point deadline);
+
+private:
+    // 第一轮带状DP的最小带宽
+    static const int INITIAL_BAND = 8;
+};
+
+#endif // ANYTIME_EDIT_DISTANCE_H
@@ -1,38 +1,502 @@
 #include "bfs_edit_distance.h"
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 
 using namespace std;
 
-int BFSEditDistance::basicBFSEditDistance(const string& start, const string& target) {
-    if (start == target) return 0;
+namespace {
+
+// 状态编码：不超过PACKED_MAX_LENGTH个字符的状态按每字符5位打包进64位整数，
+// 符号从1开始编号，0表示结束，因此长度由最高的非零符号确定；
+// 更长的状态（或字符种类超过31时的全部状态）存入字符串池，键为最高位置1的池内编号
+const int PACKED_BITS = 5;
+const int PACKED_MAX_LENGTH = 12;
+const int PACKED_MAX_SYMBOLS = 31;
+const uint64_t SYMBOL_MASK = (1ULL << PACKED_BITS) - 1;
+const uint64_t INTERNED_FLAG = 1ULL << 63;
+const uint64_t EMPTY_KEY = ~0ULL;
+
+inline uint64_t mixKey(uint64_t key) {
+    return key * 0x9E3779B97F4A7C15ULL;
+}
+
+inline uint64_t lowBits(int count) {
+    return count >= 64 ? ~0ULL : (1ULL << count) - 1;
+}
+
+// 开放寻址哈希表（线性探测，装载因子不超过1/2）：状态键 -> 非负整数
+class StateTable {
+public:
+    StateTable() : slots(1024), shift(64 - 10), count(0) {
+        for (auto& slot : slots) slot.key = EMPTY_KEY;
+    }
+    
+    // 键不存在时插入并返回true，已存在时不修改并返回false
+    bool insert(uint64_t key, int value) {
+        size_t index = locate(key);
+        if (slots[index].key == key) return false;
+        slots[index].key = key;
+        slots[index].value = value;
+        if (++count * 2 > slots.size()) grow();
+        return true;
+    }
+    
+    // 不存在时返回-1
+    int find(uint64_t key) const {
+        const Slot& slot = slots[locate(key)];
+        return slot.key == key ? slot.value : -1;
+    }
+    
+    size_t size() const {
+        return count;
+    }
+
+private:
+    struct Slot {
+        uint64_t key;
+        int value;
+    };
+    
+    std::vector<Slot> slots;
+    int shift;
+    size_t count;
+    
+    // 键所在的槽，不存在时为探测序列上的第一个空槽
+    size_t locate(uint64_t key) const {
+        size_t mask = slots.size() - 1;
+        size_t index = (size_t)(mixKey(key) >> shift);
+        while (slots[index].key != key && slots[index].key != EMPTY_KEY) {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+    
+    void grow() {
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.resize(old.size() * 2);
+        for (auto& slot : slots) slot.key = EMPTY_KEY;
+        shift--;
+        for (const auto& slot : old) {
+            if (slot.key != EMPTY_KEY) {
+                slots[locate(slot.key)] = slot;
+            }
+        }
+    }
+};
+
+// 一次搜索的状态空间：字符到5位符号的映射、长状态的字符串池，以及生成邻居用的可复用缓冲区。
+// 字符集只包含起点串和目标串中出现的字节，可以是任意字节值
+class StateSpace {
+public:
+    StateSpace(const string& start, const string& target) : interned_count(0), intern_slots(1024, 0) {
+        memset(symbol_of, 0, sizeof(symbol_of));
+        int symbols = 0;
+        bool seen[2][256] = {{false}};
+        
+        // 朝目标方向搜索时只写入目标串的字符，反向搜索时只写入起点串的字符
+        const string* sources[2] = {&target, &start};
+        for (int direction = 0; direction < 2; direction++) {
+            for (char c : *sources[direction]) {
+                unsigned char u = (unsigned char)c;
+                if (!seen[direction][u]) {
+                    seen[direction][u] = true;
+                    edit_chars[direction].push_back(c);
+                }
+                if (symbol_of[u] == 0 && symbols <= PACKED_MAX_SYMBOLS) {
+                    symbols++;
+                    if (symbols <= PACKED_MAX_SYMBOLS) {
+                        symbol_of[u] = (uint8_t)symbols;
+                        char_of[symbols] = c;
+                    }
+                }
+            }
+        }
+        packable = symbols <= PACKED_MAX_SYMBOLS;
+        for (int direction = 0; direction < 2; direction++) {
+            for (char c : edit_chars[direction]) {
+                edit_symbols[direction].push_back(symbol_of[(unsigned char)c]);
+            }
+        }
+        offsets.push_back(0);
+    }
     
-    queue<pair<string, int>> q;
-    unordered_set<string> visited;
+    uint64_t encode(const string& str) {
+        return keyOf(str.data(), str.length());
+    }
     
-    q.push(make_pair(start, 0));
-    visited.insert(start);
+    void decode(uint64_t key, string& out) const {
+        out.clear();
+        if (key & INTERNED_FLAG) {
+            uint32_t id = (uint32_t)(key & ~INTERNED_FLAG);
+            out.assign(arena.data() + offsets[id], offsets[id + 1] - offsets[id]);
+            return;
+        }
+        for (; key != 0; key >>= PACKED_BITS) {
+            out.push_back(char_of[key & SYMBOL_MASK]);
+        }
+    }
     
-    while (!q.empty()) {
-        pair<string, int> current_pair = q.front();
-        q.pop();
+    uint64_t keyOf(const char* data, size_t length) {
+        if (packable && length <= (size_t)PACKED_MAX_LENGTH) {
+            uint64_t key = 0;
+            for (size_t i = length; i-- > 0;) {
+                key = (key << PACKED_BITS) | symbol_of[(unsigned char)data[i]];
+            }
+            return key;
+        }
+        return INTERNED_FLAG | intern(data, length);
+    }
+
+private:
+    friend class SuccessorIterator;
+    
+    bool packable;
+    uint8_t symbol_of[256];
+    char char_of[PACKED_MAX_SYMBOLS + 1];
+    std::vector<char> edit_chars[2];
+    std::vector<uint64_t> edit_symbols[2];
+    
+    // 字符串池：第id个字符串为arena[offsets[id], offsets[id+1])，intern_slots存id+1（0为空）
+    std::vector<char> arena;
+    std::vector<uint32_t> offsets;
+    std::vector<uint64_t> interned_hashes;
+    uint32_t interned_count;
+    std::vector<uint32_t> intern_slots;
+    
+    // 展开长状态和构造其邻居的缓冲区，同一时刻只有一个迭代器使用
+    std::string buffer;
+    std::string neighbour;
+    
+    // 字符串池去重：FNV-1a哈希 + 线性探测
+    uint32_t intern(const char* data, size_t length) {
+        uint64_t hash = 1469598103934665603ULL;
+        for (size_t i = 0; i < length; i++) {
+            hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+        }
         
-        string current = current_pair.first;
-        int cost = current_pair.second;
+        size_t mask = intern_slots.size() - 1;
+        size_t index = (size_t)(mixKey(hash) >> 32) & mask;
+        while (intern_slots[index] != 0) {
+            uint32_t id = intern_slots[index] - 1;
+            if (interned_hashes[id] == hash && offsets[id + 1] - offsets[id] == length &&
+                memcmp(arena.data() + offsets[id], data, length) == 0) {
+                return id;
+            }
+            index = (index + 1) & mask;
+        }
         
-        // 生成所有可能的下一步状态
-        vector<string> next_states = generateNextStates(current);
+        uint32_t id = interned_count++;
+        arena.insert(arena.end(), data, data + length);
+        offsets.push_back((uint32_t)arena.size());
+        interned_hashes.push_back(hash);
+        intern_slots[index] = id + 1;
         
-        for (const string& next_state : next_states) {
-            if (next_state == target) {
-                return cost + 1;
+        if ((size_t)interned_count * 2 > intern_slots.size()) {
+            std::vector<uint32_t> resized(intern_slots.size() * 2, 0);
+            size_t new_mask = resized.size() - 1;
+            for (uint32_t i = 0; i < interned_count; i++) {
+                size_t slot = (size_t)(mixKey(interned_hashes[i]) >> 32) & new_mask;
+                while (resized[slot] != 0) slot = (slot + 1) & new_mask;
+                resized[slot] = i + 1;
             }
-            
-            if (visited.find(next_state) == visited.end()) {
-                visited.insert(next_state);
-                q.push(make_pair(next_state, cost + 1));
+            intern_slots.swap(resized);
+        }
+        return id;
+    }
+};
+
+// 邻居状态的惰性迭代器：按删除、插入、替换的顺序每次生成一个邻居键。
+// 打包状态的邻居键由位运算直接得到；长状态（以及插入后会超过打包长度的状态）
+// 展开到StateSpace的缓冲区中，在其上构造邻居。
+// 插入和替换只写入目标串中出现的字符：最优编辑序列中新写入的字符都来自目标串。
+// 在一段相同字符中删除任意一个、或在其中任意位置插入同一字符，得到的字符串相同，
+// 规定只取最左边的位置，不生成重复的邻居
+class SuccessorIterator {
+public:
+    // toward_start为true时用于双向搜索的反向一侧，写入的字符来自起点串
+    SuccessorIterator(StateSpace& state_space, uint64_t state_key, bool toward_start = false)
+        : space(state_space), key(state_key), packed(false), length(0),
+          edit_count(state_space.edit_chars[toward_start ? 1 : 0].size()),
+          edit_chars(state_space.edit_chars[toward_start ? 1 : 0].data()),
+          edit_symbols(state_space.edit_symbols[toward_start ? 1 : 0].data()),
+          phase(DELETE_PHASE), position(0), choice(0) {
+        if (!(key & INTERNED_FLAG)) {
+            for (uint64_t rest = key; rest != 0; rest >>= PACKED_BITS) length++;
+            packed = length < PACKED_MAX_LENGTH;
+        }
+        if (!packed) {
+            space.decode(key, space.buffer);
+            length = (int)space.buffer.length();
+        }
+    }
+    
+    // 取下一个邻居键，没有更多邻居时返回false
+    bool next(uint64_t& neighbour) {
+        while (true) {
+            switch (phase) {
+                case DELETE_PHASE: {
+                    if (position >= length) {
+                        phase = INSERT_PHASE;
+                        position = 0;
+                        choice = 0;
+                        continue;
+                    }
+                    int i = position++;
+                    if (i > 0 && at(i) == at(i - 1)) continue;
+                    neighbour = deleteAt(i);
+                    return true;
+                }
+                case INSERT_PHASE: {
+                    if (position > length || edit_count == 0) {
+                        phase = REPLACE_PHASE;
+                        position = 0;
+                        choice = 0;
+                        continue;
+                    }
+                    if (choice >= edit_count) {
+                        choice = 0;
+                        position++;
+                        continue;
+                    }
+                    size_t c = choice++;
+                    if (position > 0 && at(position - 1) == code(c)) continue;
+                    neighbour = insertAt(position, c);
+                    return true;
+                }
+                case REPLACE_PHASE: {
+                    if (position >= length || edit_count == 0) {
+                        phase = FINISHED;
+                        continue;
+                    }
+                    if (choice >= edit_count) {
+                        choice = 0;
+                        position++;
+                        continue;
+                    }
+                    size_t c = choice++;
+                    if (at(position) == code(c)) continue;
+                    neighbour = replaceAt(position, c);
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+    }
+
+private:
+    enum Phase { DELETE_PHASE, INSERT_PHASE, REPLACE_PHASE, FINISHED };
+    
+    StateSpace& space;
+    uint64_t key;
+    bool packed;
+    int length;
+    size_t edit_count;
+    const char* edit_chars;
+    const uint64_t* edit_symbols;
+    Phase phase;
+    int position;
+    size_t choice;
+    
+    // 打包状态比较符号，展开的状态比较字节
+    uint64_t at(int i) const {
+        return packed ? (key >> (i * PACKED_BITS)) & SYMBOL_MASK : (unsigned char)space.buffer[i];
+    }
+    
+    uint64_t code(size_t c) const {
+        return packed ? edit_symbols[c] : (unsigned char)edit_chars[c];
+    }
+    
+    uint64_t deleteAt(int i) {
+        if (packed) {
+            int shift = i * PACKED_BITS;
+            return (key & lowBits(shift)) | ((key >> (shift + PACKED_BITS)) << shift);
+        }
+        space.neighbour.assign(space.buffer, 0, i);
+        space.neighbour.append(space.buffer, i + 1, string::npos);
+        return space.keyOf(space.neighbour.data(), space.neighbour.length());
+    }
+    
+    uint64_t insertAt(int i, size_t c) {
+        if (packed) {
+            int shift = i * PACKED_BITS;
+            uint64_t low = key & lowBits(shift);
+            uint64_t high = (key >> shift) << (shift + PACKED_BITS);
+            return low | high | (edit_symbols[c] << shift);
+        }
+        space.neighbour.assign(space.buffer, 0, i);
+        space.neighbour.push_back(edit_chars[c]);
+        space.neighbour.append(space.buffer, i, string::npos);
+        return space.keyOf(space.neighbour.data(), space.neighbour.length());
+    }
+    
+    uint64_t replaceAt(int i, size_t c) {
+        if (packed) {
+            int shift = i * PACKED_BITS;
+            return (key & ~(SYMBOL_MASK << shift)) | (edit_symbols[c] << shift);
+        }
+        space.neighbour = space.buffer;
+        space.neighbour[i] = edit_chars[c];
+        return space.keyOf(space.neighbour.data(), space.neighbour.length());
+    }
+};
+
+// 搜索图：每个访问过的状态一个节点，前驱以链表形式存放在同一数组中
+// （全部最优路径模式下一个节点可以有多个前驱，构成最短路径DAG）
+class SearchGraph {
+public:
+    int addNode(uint64_t key, int cost, int parent) {
+        Node node;
+        node.key = key;
+        node.cost = cost;
+        node.first_edge = -1;
+        nodes.push_back(node);
+        int index = (int)nodes.size() - 1;
+        if (parent >= 0) addPredecessor(index, parent);
+        return index;
+    }
+    
+    void addPredecessor(int node, int parent) {
+        int head = nodes[node].first_edge;
+        // 同一父状态可能生成两次相同的邻居（如删除相邻的两个相同字符），只记录一次
+        if (head >= 0 && edges[head].parent == parent) return;
+        Edge edge;
+        edge.parent = parent;
+        edge.next = head;
+        edges.push_back(edge);
+        nodes[node].first_edge = (int)edges.size() - 1;
+    }
+    
+    // 找到代价更低的路径时丢弃原有前驱，只保留新的父状态
+    void relink(int node, int cost, int parent) {
+        nodes[node].cost = cost;
+        nodes[node].first_edge = -1;
+        addPredecessor(node, parent);
+    }
+    
+    int size() const {
+        return (int)nodes.size();
+    }
+    
+    uint64_t key(int node) const {
+        return nodes[node].key;
+    }
+    
+    int cost(int node) const {
+        return nodes[node].cost;
+    }
+    
+    /**
+     * 对从根到node的每条路径（节点下标，按根到node的顺序）调用visit；visit返回false时停止
+     */
+    template <typename Visit>
+    bool forEachPath(int node, Visit visit) const {
+        vector<int> suffix;
+        return walk(node, suffix, visit);
+    }
+
+private:
+    struct Node {
+        uint64_t key;
+        int cost;
+        int first_edge;     // 前驱链表头，根为-1
+    };
+    
+    struct Edge {
+        int parent;
+        int next;
+    };
+    
+    vector<Node> nodes;
+    vector<Edge> edges;
+    
+    template <typename Visit>
+    bool walk(int node, vector<int>& suffix, Visit& visit) const {
+        suffix.push_back(node);
+        bool go_on = true;
+        if (nodes[node].first_edge < 0) {
+            vector<int> path(suffix.rbegin(), suffix.rend());
+            go_on = visit(path);
+        } else {
+            for (int e = nodes[node].first_edge; e >= 0 && go_on; e = edges[e].next) {
+                go_on = walk(edges[e].parent, suffix, visit);
+            }
+        }
+        suffix.pop_back();
+        return go_on;
+    }
+};
+
+// 搜索结束后沿前驱重建到target_node的全部路径，逐条交给on_path
+void emitPaths(const SearchGraph& graph, const StateSpace& space, int target_node,
+               const BFSEditDistance::PathCallback& on_path) {
+    if (target_node < 0) return;
+    
+    vector<string> path;
+    graph.forEachPath(target_node, [&](const vector<int>& nodes) {
+        path.resize(nodes.size());
+        for (size_t i = 0; i < nodes.size(); i++) {
+            space.decode(graph.key(nodes[i]), path[i]);
+        }
+        return on_path(path);
+    });
+}
+
+// A*的启发式：max(长度差, 字符直方图距离)是编辑距离的下界，且一次编辑至多使其变化1（一致）。
+// 目标的计数取负存入diff，统计状态字符时只访问出现过的桶，每次计算O(状态长度)
+class BagLowerBound {
+public:
+    explicit BagLowerBound(const string& target) : target_length((int)target.length()) {
+        memset(diff, 0, sizeof(diff));
+        for (char c : target) diff[(unsigned char)c]--;
+    }
+    
+    int operator()(const string& current) {
+        // 超出目标计数的字符数；其余字符都能与目标中的字符配对
+        int surplus = 0;
+        for (char c : current) {
+            if (++diff[(unsigned char)c] > 0) surplus++;
+        }
+        for (char c : current) diff[(unsigned char)c]--;
+        int deficit = target_length - ((int)current.length() - surplus);
+        return max(surplus, deficit);
+    }
+
+private:
+    int diff[256];
+    int target_length;
+};
+
+} // namespace
+
+int BFSEditDistance::basicBFSEditDistance(const string& start, const string& target) {
+    if (start == target) return 0;
+    
+    StateSpace space(start, target);
+    uint64_t target_key = space.encode(target);
+    
+    // 逐层扩展，队列和访问集合中只保存64位状态键
+    StateTable visited;
+    vector<uint64_t> frontier(1, space.encode(start));
+    vector<uint64_t> next_frontier;
+    visited.insert(frontier[0], 0);
+    
+    for (int cost = 0; !frontier.empty(); cost++) {
+        next_frontier.clear();
+        for (uint64_t key : frontier) {
+            SuccessorIterator successors(space, key);
+            uint64_t next;
+            while (successors.next(next)) {
+                if (next == target_key) return cost + 1;
+                if (visited.insert(next, cost + 1)) {
+                    next_frontier.push_back(next);
+                }
             }
         }
+        frontier.swap(next_frontier);
     }
     
     return -1; // 不应该到达这里
@@ -41,6 +505,18 @@ int BFSEditDistance::basicBFSEditDistance(const string& start, const string& tar
 BFSEditDistance::BFSResult BFSEditDistance::completeBFSEditDistance(
     const string& start, const string& target) {
     
+    vector<vector<string>> paths;
+    BFSResult result = completeBFSEditDistance(start, target, [&](const vector<string>& path) {
+        paths.push_back(path);
+        return true;
+    });
+    result.all_paths.swap(paths);
+    return result;
+}
+
+BFSEditDistance::BFSResult BFSEditDistance::completeBFSEditDistance(
+    const string& start, const string& target, const PathCallback& on_path) {
+    
     auto start_time = chrono::high_resolution_clock::now();
     
     BFSResult result;
@@ -50,67 +526,62 @@ BFSEditDistance::BFSResult BFSEditDistance::completeBFSEditDistance(
     
     if (start == target) {
         result.min_distance = 0;
-        result.all_paths.push_back(vector<string>(1, start));
+        on_path(vector<string>(1, start));
         auto end_time = chrono::high_resolution_clock::now();
         auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
         result.computation_time = duration.count() / 1000.0;
         return result;
     }
     
-    queue<State> q;
-    unordered_map<string, int> best_cost; // 记录到达每个状态的最小代价
+    // 逐层扩展；同一层内再次到达的状态只增加一个前驱，每个状态只入队一次
+    StateSpace space(start, target);
+    uint64_t target_key = space.encode(target);
+    SearchGraph graph;
+    StateTable node_of;
+    int target_node = -1;
     
-    vector<string> initial_path(1, start);
-    q.push(State(start, 0, initial_path));
-    best_cost[start] = 0;
+    vector<int> frontier(1, graph.addNode(space.encode(start), 0, -1));
+    vector<int> next_frontier;
+    node_of.insert(graph.key(frontier[0]), frontier[0]);
     
-    while (!q.empty()) {
-        result.max_queue_size = max(result.max_queue_size, (int)q.size());
+    for (int cost = 0; !frontier.empty() && target_node < 0; cost++) {
+        result.max_queue_size = max(result.max_queue_size, (int)frontier.size());
+        next_frontier.clear();
         
-        State current = q.front();
-        q.pop();
-        result.nodes_explored++;
-        
-        // 如果已经找到最优解，且当前代价大于最优解，跳过
-        if (result.min_distance != -1 && current.cost > result.min_distance) {
-            continue;
-        }
-        
-        // 生成所有可能的下一步状态
-        vector<string> next_states = generateNextStates(current.current_string);
-        
-        for (const string& next_state : next_states) {
-            int new_cost = current.cost + 1;
-            
-            if (next_state == target) {
-                // 找到目标状态
-                if (result.min_distance == -1 || new_cost < result.min_distance) {
-                    // 找到更优解
-                    result.min_distance = new_cost;
-                    result.all_paths.clear();
-                    vector<string> new_path = current.path;
-                    new_path.push_back(target);
-                    result.all_paths.push_back(new_path);
-                } else if (new_cost == result.min_distance) {
-                    // 找到等优解
-                    vector<string> new_path = current.path;
-                    new_path.push_back(target);
-                    result.all_paths.push_back(new_path);
+        for (int current : frontier) {
+            result.nodes_explored++;
+            SuccessorIterator successors(space, graph.key(current));
+            uint64_t next;
+            while (successors.next(next)) {
+                if (next == target_key) {
+                    // 找到目标状态；同一层的其他前驱都是等优解
+                    if (target_node < 0) {
+                        target_node = graph.addNode(next, cost + 1, current);
+                        result.min_distance = cost + 1;
+                    } else {
+                        graph.addPredecessor(target_node, current);
+                    }
+                    continue;
                 }
-            } else {
-                // 中间状态，继续搜索
-                if (best_cost.find(next_state) == best_cost.end() || 
-                    new_cost <= best_cost[next_state]) {
-                    
-                    best_cost[next_state] = new_cost;
-                    vector<string> new_path = current.path;
-                    new_path.push_back(next_state);
-                    q.push(State(next_state, new_cost, new_path));
+                
+                int node = node_of.find(next);
+                if (node < 0) {
+                    // 已找到目标时，本层新状态不会出现在最优路径上
+                    if (target_node < 0) {
+                        node = graph.addNode(next, cost + 1, current);
+                        node_of.insert(next, node);
+                        next_frontier.push_back(node);
+                    }
+                } else if (graph.cost(node) == cost + 1) {
+                    graph.addPredecessor(node, current);
                 }
             }
         }
+        frontier.swap(next_frontier);
     }
     
+    emitPaths(graph, space, target_node, on_path);
+    
     auto end_time = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
     result.computation_time = duration.count() / 1000.0;
@@ -137,63 +608,80 @@ BFSEditDistance::BFSResult BFSEditDistance::optimizedBFSEditDistance(
         return result;
     }
     
-    // 使用优先队列实现A*搜索的思想
-    priority_queue<pair<int, State>, vector<pair<int, State>>, greater<pair<int, State>>> pq;
-    unordered_map<string, int> best_cost;
-    
-    int h = heuristic(start, target);
-    vector<string> initial_path(1, start);
-    pq.push(make_pair(h, State(start, 0, initial_path)));
-    best_cost[start] = 0;
-    
-    while (!pq.empty()) {
-        result.max_queue_size = max(result.max_queue_size, (int)pq.size());
+    // A*搜索：f = g + h，h为一致（单调）的下界，
+    // 因此每个状态第一次出队时代价已是最优，出队后放入关闭集合不再扩展
+    StateSpace space(start, target);
+    uint64_t target_key = space.encode(target);
+    BagLowerBound heuristic(target);
+    SearchGraph graph;
+    StateTable node_of;         // 状态键 -> 搜索图节点，节点代价即已知的最小代价
+    vector<char> closed;        // 按节点下标
+    int target_node = -1;
+    string buffer;
+    
+    priority_queue<State> open;
+    
+    int root = graph.addNode(space.encode(start), 0, -1);
+    node_of.insert(graph.key(root), root);
+    closed.push_back(0);
+    open.push(State(root, 0, heuristic(start)));
+    
+    while (!open.empty()) {
+        result.max_queue_size = max(result.max_queue_size, (int)open.size());
         
-        pair<int, State> current_pair = pq.top();
-        pq.pop();
+        State current = open.top();
+        open.pop();
         
-        int f_cost = current_pair.first;
-        State current = current_pair.second;
-        result.nodes_explored++;
-        
-        // 剪枝：如果已经找到最优解，且当前代价大于最优解，跳过
-        if (result.min_distance != -1 && current.cost >= result.min_distance) {
+        // 跳过已关闭的状态和找到更短路径后的过期项
+        if (closed[current.node] || current.cost > graph.cost(current.node)) {
             continue;
         }
+        closed[current.node] = 1;
         
-        vector<string> next_states = generateNextStates(current.current_string);
+        if (current.node == target_node) {
+            result.min_distance = current.cost;
+            break;
+        }
+        result.nodes_explored++;
         
-        for (const string& next_state : next_states) {
-            int new_cost = current.cost + 1;
-            
-            if (next_state == target) {
-                if (result.min_distance == -1 || new_cost < result.min_distance) {
-                    result.min_distance = new_cost;
-                    result.all_paths.clear();
-                    vector<string> new_path = current.path;
-                    new_path.push_back(target);
-                    result.all_paths.push_back(new_path);
-                } else if (new_cost == result.min_distance) {
-                    vector<string> new_path = current.path;
-                    new_path.push_back(target);
-                    result.all_paths.push_back(new_path);
-                }
+        int new_cost = current.cost + 1;
+        SuccessorIterator successors(space, graph.key(current.node));
+        uint64_t next;
+        while (successors.next(next)) {
+            int node = node_of.find(next);
+            if (node < 0) {
+                node = graph.addNode(next, new_cost, current.node);
+                node_of.insert(next, node);
+                closed.push_back(0);
+                if (next == target_key) target_node = node;
+            } else if (closed[node]) {
+                continue;
+            } else if (new_cost < graph.cost(node)) {
+                graph.relink(node, new_cost, current.node);
             } else {
-                if (best_cost.find(next_state) == best_cost.end() || 
-                    new_cost < best_cost[next_state]) {
-                    
-                    best_cost[next_state] = new_cost;
-                    vector<string> new_path = current.path;
-                    new_path.push_back(next_state);
-                    
-                    int h_cost = heuristic(next_state, target);
-                    int f_cost = new_cost + h_cost;
-                    pq.push(make_pair(f_cost, State(next_state, new_cost, new_path)));
+                // 目标状态记录所有等代价的前驱，得到多条最优路径
+                if (node == target_node && new_cost == graph.cost(node)) {
+                    graph.addPredecessor(node, current.node);
                 }
+                continue;
+            }
+            
+            int h_cost = 0;
+            if (node != target_node) {
+                space.decode(next, buffer);
+                h_cost = heuristic(buffer);
             }
+            open.push(State(node, new_cost, new_cost + h_cost));
         }
     }
     
+    if (result.min_distance >= 0) {
+        emitPaths(graph, space, target_node, [&](const vector<string>& path) {
+            result.all_paths.push_back(path);
+            return true;
+        });
+    }
+    
     auto end_time = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
     result.computation_time = duration.count() / 1000.0;
@@ -220,93 +708,47 @@ BFSEditDistance::BFSResult BFSEditDistance::bidirectionalBFS(
         return result;
     }
     
-    // 正向搜索
-    queue<pair<string, int>> forward_queue;
-    unordered_map<string, int> forward_visited;
-    
-    // 反向搜索
-    queue<pair<string, int>> backward_queue;
-    unordered_map<string, int> backward_visited;
+    // 两个方向共用同一状态空间，键可以直接比较；每次完整扩展较小一侧的一层
+    StateSpace space(start, target);
+    StateTable visited[2];
+    vector<uint64_t> frontier[2];
+    int depth[2] = {0, 0};
+    vector<uint64_t> next_frontier;
     
-    forward_queue.push(make_pair(start, 0));
-    forward_visited[start] = 0;
+    frontier[0].push_back(space.encode(start));
+    frontier[1].push_back(space.encode(target));
+    visited[0].insert(frontier[0][0], 0);
+    visited[1].insert(frontier[1][0], 0);
     
-    backward_queue.push(make_pair(target, 0));
-    backward_visited[target] = 0;
-    
-    while (!forward_queue.empty() || !backward_queue.empty()) {
-        result.max_queue_size = max(result.max_queue_size, 
-                                   (int)(forward_queue.size() + backward_queue.size()));
+    while (!frontier[0].empty() && !frontier[1].empty()) {
+        result.max_queue_size = max(result.max_queue_size, (int)(frontier[0].size() + frontier[1].size()));
         
-        // 正向搜索一步
-        if (!forward_queue.empty()) {
-            pair<string, int> current_pair = forward_queue.front();
-            forward_queue.pop();
-            
-            string current = current_pair.first;
-            int cost = current_pair.second;
-            result.nodes_explored++;
-            
-            vector<string> next_states = generateNextStates(current);
-            for (const string& next_state : next_states) {
-                int new_cost = cost + 1;
-                
-                // 检查是否与反向搜索相遇
-                if (backward_visited.find(next_state) != backward_visited.end()) {
-                    int total_cost = new_cost + backward_visited[next_state];
-                    if (result.min_distance == -1 || total_cost < result.min_distance) {
-                        result.min_distance = total_cost;
-                    }
-                }
-                
-                if (forward_visited.find(next_state) == forward_visited.end() ||
-                    new_cost < forward_visited[next_state]) {
-                    forward_visited[next_state] = new_cost;
-                    forward_queue.push(make_pair(next_state, new_cost));
-                }
-            }
-        }
+        int side = frontier[0].size() <= frontier[1].size() ? 0 : 1;
+        StateTable& own = visited[side];
+        const StateTable& other = visited[1 - side];
+        int new_cost = depth[side] + 1;
         
-        // 反向搜索一步
-        if (!backward_queue.empty()) {
-            pair<string, int> current_pair = backward_queue.front();
-            backward_queue.pop();
-            
-            string current = current_pair.first;
-            int cost = current_pair.second;
+        // 一层中所有相遇点的最小总代价即为最短距离：
+        // 另一侧已访问的状态都带有精确的BFS距离，最短路径上距本侧new_cost步的状态必在其中
+        next_frontier.clear();
+        for (uint64_t key : frontier[side]) {
             result.nodes_explored++;
-            
-            vector<string> next_states = generateNextStates(current);
-            for (const string& next_state : next_states) {
-                int new_cost = cost + 1;
-                
-                // 检查是否与正向搜索相遇
-                if (forward_visited.find(next_state) != forward_visited.end()) {
-                    int total_cost = new_cost + forward_visited[next_state];
-                    if (result.min_distance == -1 || total_cost < result.min_distance) {
-                        result.min_distance = total_cost;
-                    }
+            SuccessorIterator successors(space, key, side == 1);
+            uint64_t next;
+            while (successors.next(next)) {
+                int other_cost = other.find(next);
+                if (other_cost >= 0 && (result.min_distance == -1 || new_cost + other_cost < result.min_distance)) {
+                    result.min_distance = new_cost + other_cost;
                 }
-                
-                if (backward_visited.find(next_state) == backward_visited.end() ||
-                    new_cost < backward_visited[next_state]) {
-                    backward_visited[next_state] = new_cost;
-                    backward_queue.push(make_pair(next_state, new_cost));
+                if (own.insert(next, new_cost)) {
+                    next_frontier.push_back(next);
                 }
             }
         }
+        frontier[side].swap(next_frontier);
+        depth[side] = new_cost;
         
-        // 如果找到解且队列中的状态代价都大于当前最优解，可以提前退出
-        if (result.min_distance != -1) {
-            bool can_stop = true;
-            if (!forward_queue.empty() && forward_queue.front().second <= result.min_distance) {
-                can_stop = false;
-            }
-            if (!backward_queue.empty() && backward_queue.front().second <= result.min_distance) {
-                can_stop = false;
-            }
-            if (can_stop) break;
-        }
+        if (result.min_distance != -1) break;
     }
     
     auto end_time = chrono::high_resolution_clock::now();
@@ -335,50 +777,49 @@ BFSEditDistance::BFSResult BFSEditDistance::limitedBFS(
         return result;
     }
     
-    queue<State> q;
-    unordered_set<string> visited;
-    
-    vector<string> initial_path(1, start);
-    q.push(State(start, 0, initial_path));
-    visited.insert(start);
-    
-    while (!q.empty()) {
-        result.max_queue_size = max(result.max_queue_size, (int)q.size());
-        
-        State current = q.front();
-        q.pop();
-        result.nodes_explored++;
-        
-        // 检查深度限制
-        if (current.cost >= max_depth) {
-            continue;
-        }
+    // 逐层扩展，每个状态只记录第一次到达时的父状态；目标状态记录同一层的所有前驱
+    StateSpace space(start, target);
+    uint64_t target_key = space.encode(target);
+    SearchGraph graph;
+    StateTable node_of;
+    int target_node = -1;
+    
+    vector<int> frontier(1, graph.addNode(space.encode(start), 0, -1));
+    vector<int> next_frontier;
+    node_of.insert(graph.key(frontier[0]), frontier[0]);
+    
+    // 检查深度限制：只扩展代价小于max_depth的状态
+    for (int cost = 0; cost < max_depth && !frontier.empty() && target_node < 0; cost++) {
+        result.max_queue_size = max(result.max_queue_size, (int)frontier.size());
+        next_frontier.clear();
         
-        vector<string> next_states = generateNextStates(current.current_string);
-        
-        for (const string& next_state : next_states) {
-            if (next_state == target) {
-                int new_cost = current.cost + 1;
-                if (result.min_distance == -1 || new_cost < result.min_distance) {
-                    result.min_distance = new_cost;
-                    result.all_paths.clear();
-                    vector<string> new_path = current.path;
-                    new_path.push_back(target);
-                    result.all_paths.push_back(new_path);
-                } else if (new_cost == result.min_distance) {
-                    vector<string> new_path = current.path;
-                    new_path.push_back(target);
-                    result.all_paths.push_back(new_path);
+        for (int current : frontier) {
+            result.nodes_explored++;
+            SuccessorIterator successors(space, graph.key(current));
+            uint64_t next;
+            while (successors.next(next)) {
+                if (next == target_key) {
+                    if (target_node < 0) {
+                        target_node = graph.addNode(next, cost + 1, current);
+                        result.min_distance = cost + 1;
+                    } else {
+                        graph.addPredecessor(target_node, current);
+                    }
+                } else if (node_of.find(next) < 0) {
+                    int node = graph.addNode(next, cost + 1, current);
+                    node_of.insert(next, node);
+                    next_frontier.push_back(node);
                 }
-            } else if (visited.find(next_state) == visited.end()) {
-                visited.insert(next_state);
-                vector<string> new_path = current.path;
-                new_path.push_back(next_state);
-                q.push(State(next_state, current.cost + 1, new_path));
             }
         }
+        frontier.swap(next_frontier);
     }
     
+    emitPaths(graph, space, target_node, [&](const vector<string>& path) {
+        result.all_paths.push_back(path);
+        return true;
+    });
+    
     auto end_time = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
     result.computation_time = duration.count() / 1000.0;
@@ -386,42 +827,12 @@ BFSEditDistance::BFSResult BFSEditDistance::limitedBFS(
     return result;
 }
 
-vector<string> BFSEditDistance::generateNextStates(const string& current) {
-    vector<string> next_states;
-    
-    // 删除操作
+void BFSEditDistance::generateDeletions(const string& current, vector<string>& deletions) {
     for (int i = 0; i < current.length(); i++) {
         string next = current;
         next.erase(i, 1);
-        next_states.push_back(next);
+        deletions.push_back(next);
     }
-    
-    // 插入操作
-    for (int i = 0; i <= current.length(); i++) {
-        for (char c = 'a'; c <= 'z'; c++) {
-            string next = current;
-            next.insert(i, 1, c);
-            next_states.push_back(next);
-        }
-    }
-    
-    // 替换操作
-    for (int i = 0; i < current.length(); i++) {
-        for (char c = 'a'; c <= 'z'; c++) {
-            if (c != current[i]) {
-                string next = current;
-                next[i] = c;
-                next_states.push_back(next);
-            }
-        }
-    }
-    
-    return next_states;
-}
-
-int BFSEditDistance::heuristic(const string& current, const string& target) {
-    // 简单的启发式函数：字符串长度差的绝对值
-    return abs((int)current.length() - (int)target.length());
 }
 
 string BFSEditDistance::stateToString(const string& str) {
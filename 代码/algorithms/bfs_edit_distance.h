@@ -6,25 +6,28 @@
 #include <queue>
 #include <unordered_set>
 #include <unordered_map>
+#include <functional>
 
 /**
  * 基于BFS的编辑距离算法实现
  */
 class BFSEditDistance {
 public:
-    // 状态结构：表示搜索过程中的一个字符串状态
+    // 搜索队列中的状态：只记录搜索图中的节点下标，路径在搜索结束后沿父指针重建
     struct State {
-        std::string current_string;  // 当前字符串
-        int cost;                   // 到达此状态的代价
-        std::vector<std::string> path; // 变换路径
+        int node;                   // 搜索图中的节点下标
+        int cost;                   // g：到达此状态的代价
+        int estimate;               // f = g + h：经过此状态的路径长度下界
         
-        State(const std::string& str, int c, const std::vector<std::string>& p)
-            : current_string(str), cost(c), path(p) {}
-            
-        // 添加比较操作符用于priority_queue
+        State(int n, int c, int e) : node(n), cost(c), estimate(e) {}
+        
+        // 用于std::priority_queue（最大堆，operator<为true表示优先级更低）：
+        // f小的先出队，f相同时g大的先出队（离目标更近）
         bool operator<(const State& other) const {
-            // 优先级队列默认是最大堆，我们需要最小堆，所以反转比较
-            return cost > other.cost;
+            if (estimate != other.estimate) {
+                return estimate > other.estimate;
+            }
+            return cost < other.cost;
         }
     };
     
@@ -36,25 +39,40 @@ public:
         double computation_time;                 // 计算时间(ms)
         int max_queue_size;                     // 队列最大长度
     };
+    
+    // 逐条接收最优路径的回调，返回false时停止枚举
+    typedef std::function<bool(const std::vector<std::string>&)> PathCallback;
 
 public:
     /**
      * 基础BFS编辑距离算法
+     * 不超过12个字符的状态按每字符5位打包为64位键，邻居键由位运算直接得到，
+     * 访问集合为开放寻址哈希表；更长的状态存入字符串池
      */
     static int basicBFSEditDistance(const std::string& start, const std::string& target);
     
     /**
      * 完整BFS算法 - 返回所有最优路径
+     * 每个访问过的状态只保存一个节点及其前驱链表（最短路径DAG），搜索结束后才展开路径
      */
     static BFSResult completeBFSEditDistance(const std::string& start, const std::string& target);
     
     /**
-     * 带剪枝的BFS算法 - 使用启发式函数提高效率
+     * 完整BFS算法 - 最优路径不存入结果，搜索结束后逐条交给on_path
+     * 最优路径的数量可能随距离指数增长，这种方式不必同时保存所有路径
+     */
+    static BFSResult completeBFSEditDistance(const std::string& start, const std::string& target,
+                                             const PathCallback& on_path);
+    
+    /**
+     * A*搜索 - 启发式为max(长度差, 字符直方图距离)，按(f, g)排序并使用关闭集合
+     * 结果为最优距离；all_paths包含目标出队前找到的所有等代价前驱对应的路径
      */
     static BFSResult optimizedBFSEditDistance(const std::string& start, const std::string& target);
     
     /**
-     * 双向BFS算法 - 从两端同时搜索
+     * 双向BFS算法 - 从两端同时搜索，每次完整扩展较小一侧的一层
+     * 状态表示与basicBFSEditDistance相同，不返回路径
      */
     static BFSResult bidirectionalBFS(const std::string& start, const std::string& target);
     
@@ -62,14 +80,13 @@ public:
      * 受限BFS算法 - 限制最大搜索深度
      */
     static BFSResult limitedBFS(const std::string& start, const std::string& target, int max_depth);
+    
+    /**
+     * 生成删除一个字符得到的所有字符串，追加到deletions末尾
+     */
+    static void generateDeletions(const std::string& current, std::vector<std::string>& deletions);
 
 private:
-    // 生成所有可能的下一步状态
-    static std::vector<std::string> generateNextStates(const std::string& current);
-    
-    // 计算启发式函数值（到目标的估计距离）
-    static int heuristic(const std::string& current, const std::string& target);
-    
     // 字符串哈希函数
     static std::string stateToString(const std::string& str);
 };
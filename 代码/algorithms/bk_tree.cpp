@@ -0,0 +1,172 @@
+#include "bk_tree.h"
+#include "dynamic_programming.h"
+#include <algorithm>
+#include <climits>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+
+using namespace std;
+
+BKTree::BKTree() {}
+
+void BKTree::build(const vector<string>& words) {
+    clear();
+    nodes.reserve(words.size());
+    for (const auto& word : words) {
+        insert(word);
+    }
+}
+
+bool BKTree::insert(const string& word) {
+    if (nodes.empty()) {
+        nodes.emplace_back(word);
+        return true;
+    }
+    
+    int current = 0;
+    while (true) {
+        int distance = DynamicProgrammingEditDistance::bitParallelEditDistance(word, nodes[current].word);
+        if (distance == 0) {
+            return false;
+        }
+        
+        int next = -1;
+        for (const auto& child : nodes[current].children) {
+            if (child.first == distance) {
+                next = child.second;
+                break;
+            }
+        }
+        
+        if (next < 0) {
+            int index = nodes.size();
+            nodes[current].children.emplace_back(distance, index);
+            nodes[current].max_edge = max(nodes[current].max_edge, distance);
+            nodes.emplace_back(word);
+            return true;
+        }
+        current = next;
+    }
+}
+
+BKTree::QueryResult BKTree::query(const string& word, int k) const {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    QueryResult result;
+    result.distance_evaluations = 0;
+    result.tree_size = nodes.size();
+    
+    vector<int> stack;
+    if (!nodes.empty() && k >= 0) {
+        stack.push_back(0);
+    }
+    
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+        
+        // 子树只需要d-k <= 边权 <= d+k，d超过max_edge+k后所有子树都被剪掉
+        int distance = boundedDistance(word, node.word, node.max_edge + k);
+        result.distance_evaluations++;
+        
+        if (distance <= k) {
+            result.matches.emplace_back(node.word, distance);
+        }
+        
+        for (const auto& child : node.children) {
+            if (child.first >= distance - k && child.first <= distance + k) {
+                stack.push_back(child.second);
+            }
+        }
+    }
+    
+    sort(result.matches.begin(), result.matches.end(),
+         [](const pair<string, int>& a, const pair<string, int>& b) {
+             return a.second != b.second ? a.second < b.second : a.first < b.first;
+         });
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    result.computation_time = chrono::duration<double, milli>(end_time - start_time).count();
+    
+    return result;
+}
+
+BKTree::QueryResult BKTree::nearest(const string& word) const {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    QueryResult result;
+    result.distance_evaluations = 0;
+    result.tree_size = nodes.size();
+    
+    int best_distance = INT_MAX;
+    int best_node = -1;
+    
+    // 栈中保存(子树距离下界, 节点)，入栈后best_distance可能继续收缩，出栈时需重新检查
+    vector<pair<int, int>> stack;
+    vector<pair<int, int>> candidates;
+    if (!nodes.empty()) {
+        stack.emplace_back(0, 0);
+    }
+    
+    while (!stack.empty()) {
+        int subtree_gap = stack.back().first;
+        int index = stack.back().second;
+        stack.pop_back();
+        
+        // 当前半径为best_distance-1（只接受严格更优的结果）
+        int radius = best_distance == INT_MAX ? INT_MAX : best_distance - 1;
+        if (subtree_gap > radius) continue;
+        
+        const Node& node = nodes[index];
+        int bound = radius == INT_MAX ? INT_MAX - 1 : node.max_edge + radius;
+        int distance = boundedDistance(word, node.word, bound);
+        result.distance_evaluations++;
+        
+        if (distance < best_distance) {
+            best_distance = distance;
+            best_node = index;
+            radius = best_distance - 1;
+            if (best_distance == 0) break;
+        }
+        
+        // 边权越接近distance的子树越可能包含更近的单词，最后入栈以便先访问，尽早收缩半径
+        candidates.clear();
+        for (const auto& child : node.children) {
+            int gap = abs(child.first - distance);
+            if (gap <= radius) {
+                candidates.emplace_back(gap, child.second);
+            }
+        }
+        sort(candidates.begin(), candidates.end(), greater<pair<int, int>>());
+        stack.insert(stack.end(), candidates.begin(), candidates.end());
+    }
+    
+    if (best_node >= 0) {
+        result.matches.emplace_back(nodes[best_node].word, best_distance);
+    }
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    result.computation_time = chrono::duration<double, milli>(end_time - start_time).count();
+    
+    return result;
+}
+
+int BKTree::size() const {
+    return nodes.size();
+}
+
+void BKTree::clear() {
+    nodes.clear();
+}
+
+int BKTree::boundedDistance(const string& a, const string& b, int bound) {
+    int length_gap = a.length() > b.length() ? a.length() - b.length() : b.length() - a.length();
+    if (bound >= (int)max(a.length(), b.length())) {
+        return DynamicProgrammingEditDistance::bitParallelEditDistance(a, b);
+    }
+    if (length_gap > bound) {
+        return bound + 1;
+    }
+    return DynamicProgrammingEditDistance::bitParallelBoundedEditDistance(a, b, bound);
+}
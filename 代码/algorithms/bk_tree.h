@@ -0,0 +1,68 @@
+#ifndef BK_TREE_H
+#define BK_TREE_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+/**
+ * BK树索引 - 用于拼写纠错等字典近似查询
+ * 每个子节点按与父节点的编辑距离挂在对应的边上，查询时由三角不等式
+ * 只需访问边权在[d-k, d+k]内的子树
+ */
+class BKTree {
+public:
+    // 查询结果
+    struct QueryResult {
+        std::vector<std::pair<std::string, int>> matches; // 命中的单词及距离，按距离排序
+        int distance_evaluations;                         // 编辑距离计算次数
+        int tree_size;                                    // 索引中的单词数
+        double computation_time;                          // 计算时间(ms)
+    };
+
+public:
+    BKTree();
+    
+    /**
+     * 批量建树 - 清空已有内容后依次插入，重复单词只保留一个
+     */
+    void build(const std::vector<std::string>& words);
+    
+    /**
+     * 插入单词，已存在时返回false
+     * 时间复杂度: O(树高*m*n/w)
+     */
+    bool insert(const std::string& word);
+    
+    /**
+     * 范围查询 - 返回与word编辑距离不超过k的所有单词
+     */
+    QueryResult query(const std::string& word, int k) const;
+    
+    /**
+     * 最近邻查询 - 返回距离最小的一个单词，索引为空时matches为空
+     * 以当前最优距离作为查询半径，随搜索进行不断收缩
+     */
+    QueryResult nearest(const std::string& word) const;
+    
+    int size() const;
+    
+    void clear();
+
+private:
+    struct Node {
+        std::string word;
+        int max_edge;                               // 子节点边权的最大值
+        std::vector<std::pair<int, int>> children;  // (边权, 子节点下标)
+        
+        explicit Node(const std::string& w) : word(w), max_edge(0) {}
+    };
+    
+    // 所有节点连续存放，nodes[0]为根
+    std::vector<Node> nodes;
+    
+    // 计算距离，超过bound时返回bound+1；子树边权不超过max_edge，超出max_edge+k的精确值不再需要
+    static int boundedDistance(const std::string& a, const std::string& b, int bound);
+};
+
+#endif // BK_TREE_H
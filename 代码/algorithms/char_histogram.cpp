@@ -0,0 +1,89 @@
+#include "char_histogram.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EDIT_DISTANCE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+void bagExcessScalar(const uint8_t* a, const uint8_t* b, int& a_excess, int& b_excess) {
+    a_excess = 0;
+    b_excess = 0;
+    for (int i = 0; i < 256; i++) {
+        if (a[i] > b[i]) a_excess += a[i] - b[i];
+        else b_excess += b[i] - a[i];
+    }
+}
+
+#ifdef EDIT_DISTANCE_X86_SIMD
+__attribute__((target("avx2")))
+void bagExcessAvx2(const uint8_t* a, const uint8_t* b, int& a_excess, int& b_excess) {
+    // 饱和减法得到各桶多出的数量，再用SAD对32个字节横向求和（结果在4个64位通道中）
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i sum_a = zero, sum_b = zero;
+    for (int i = 0; i < 256; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+        sum_a = _mm256_add_epi64(sum_a, _mm256_sad_epu8(_mm256_subs_epu8(va, vb), zero));
+        sum_b = _mm256_add_epi64(sum_b, _mm256_sad_epu8(_mm256_subs_epu8(vb, va), zero));
+    }
+    // 高低两部分合并：sum_a放在低64位通道，sum_b放在高64位通道
+    __m256i packed = _mm256_add_epi64(_mm256_unpacklo_epi64(sum_a, sum_b), _mm256_unpackhi_epi64(sum_a, sum_b));
+    __m128i folded = _mm_add_epi64(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+    a_excess = _mm_cvtsi128_si32(folded);
+    b_excess = _mm_cvtsi128_si32(_mm_unpackhi_epi64(folded, folded));
+}
+#endif
+
+} // namespace
+
+CharHistogram::CharHistogram() : total(0) {
+    memset(bins, 0, sizeof(bins));
+}
+
+CharHistogram::CharHistogram(const string& str) {
+    assign(str);
+}
+
+void CharHistogram::assign(const string& str) {
+    memset(bins, 0, sizeof(bins));
+    total = str.length();
+    for (char c : str) {
+        uint8_t& bin = bins[(unsigned char)c];
+        if (bin != 255) bin++;
+    }
+}
+
+int CharHistogram::count(char c) const {
+    return bins[(unsigned char)c];
+}
+
+int CharHistogram::length() const {
+    return total;
+}
+
+int CharHistogram::bagDistance(const CharHistogram& a, const CharHistogram& b) {
+    int a_excess, b_excess;
+#ifdef EDIT_DISTANCE_X86_SIMD
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        bagExcessAvx2(a.bins, b.bins, a_excess, b_excess);
+        return max(a_excess, b_excess);
+    }
+#endif
+    bagExcessScalar(a.bins, b.bins, a_excess, b_excess);
+    return max(a_excess, b_excess);
+}
+
+vector<CharHistogram> CharHistogram::build(const vector<string>& strings) {
+    vector<CharHistogram> signatures(strings.size());
+    for (size_t i = 0; i < strings.size(); i++) {
+        signatures[i].assign(strings[i]);
+    }
+    return signatures;
+}
@@ -0,0 +1,43 @@
+#ifndef CHAR_HISTOGRAM_H
+#define CHAR_HISTOGRAM_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * 256桶字符直方图 - 每个字节值一个8位计数器，超过255时饱和
+ * 可作为字典条目的预计算签名；直方图（bag）距离是编辑距离的下界，
+ * 饱和只会让结果变小，仍然是下界
+ */
+class CharHistogram {
+public:
+    CharHistogram();
+    
+    explicit CharHistogram(const std::string& str);
+    
+    // 重新统计str的直方图
+    void assign(const std::string& str);
+    
+    // 字符c的计数（饱和到255）
+    int count(char c) const;
+    
+    // 统计的字符串长度
+    int length() const;
+    
+    /**
+     * 直方图距离：max(a比b多出的字符数, b比a多出的字符数)
+     * 运行时检测AVX2，用饱和减法和SAD指令一次处理32个桶，不支持时使用标量实现
+     * 时间复杂度: O(256/32)
+     */
+    static int bagDistance(const CharHistogram& a, const CharHistogram& b);
+    
+    // 为一组字符串批量计算签名
+    static std::vector<CharHistogram> build(const std::vector<std::string>& strings);
+
+private:
+    uint8_t bins[256];
+    int total;
+};
+
+#endif // CHAR_HISTOGRAM_H
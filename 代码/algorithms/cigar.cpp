@@ -0,0 +1,102 @@
+#include "cigar.h"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+using namespace std;
+
+Cigar::Cigar() {}
+
+void Cigar::append(char op, int length) {
+    if (length <= 0) return;
+    if (!runs.empty() && runs.back().op == op) {
+        runs.back().length += length;
+    } else {
+        runs.emplace_back(op, length);
+    }
+}
+
+void Cigar::reverse() {
+    std::reverse(runs.begin(), runs.end());
+}
+
+const vector<Cigar::Run>& Cigar::getRuns() const {
+    return runs;
+}
+
+bool Cigar::empty() const {
+    return runs.empty();
+}
+
+int Cigar::distance() const {
+    int total = 0;
+    for (const auto& run : runs) {
+        if (run.op != MATCH) total += run.length;
+    }
+    return total;
+}
+
+int Cigar::sourceLength() const {
+    int total = 0;
+    for (const auto& run : runs) {
+        if (run.op != INSERT) total += run.length;
+    }
+    return total;
+}
+
+int Cigar::targetLength() const {
+    int total = 0;
+    for (const auto& run : runs) {
+        if (run.op != DELETE) total += run.length;
+    }
+    return total;
+}
+
+string Cigar::toString() const {
+    string text;
+    for (const auto& run : runs) {
+        text += to_string(run.length);
+        text += run.op;
+    }
+    return text;
+}
+
+Cigar Cigar::parse(const string& text) {
+    Cigar cigar;
+    long long length = 0;
+    bool has_length = false;
+    for (char c : text) {
+        if (c >= '0' && c <= '9') {
+            length = length * 10 + (c - '0');
+            if (length > INT_MAX) {
+                throw invalid_argument("Cigar: run length overflow");
+            }
+            has_length = true;
+        } else if (c == MATCH || c == REPLACE || c == INSERT || c == DELETE) {
+            if (!has_length) {
+                throw invalid_argument("Cigar: missing run length before '" + string(1, c) + "'");
+            }
+            cigar.append(c, (int)length);
+            length = 0;
+            has_length = false;
+        } else {
+            throw invalid_argument("Cigar: unexpected character '" + string(1, c) + "'");
+        }
+    }
+    if (has_length) {
+        throw invalid_argument("Cigar: trailing run length without operation");
+    }
+    return cigar;
+}
+
+bool Cigar::operator==(const Cigar& other) const {
+    if (runs.size() != other.runs.size()) return false;
+    for (size_t i = 0; i < runs.size(); i++) {
+        if (runs[i].op != other.runs[i].op || runs[i].length != other.runs[i].length) return false;
+    }
+    return true;
+}
+
+bool Cigar::operator!=(const Cigar& other) const {
+    return !(*this == other);
+}
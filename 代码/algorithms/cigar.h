@@ -0,0 +1,65 @@
+#ifndef CIGAR_H
+#define CIGAR_H
+
+#include <string>
+#include <vector>
+
+/**
+ * 游程编码的操作序列（CIGAR风格），如"12=1X3I40="
+ * '='匹配，'X'替换，'I'插入（目标串多出的字符），'D'删除（源串多出的字符）。
+ * 相邻的同类操作合并为一段，近似相同的长文本只需很少几段
+ */
+class Cigar {
+public:
+    static const char MATCH = '=';
+    static const char REPLACE = 'X';
+    static const char INSERT = 'I';
+    static const char DELETE = 'D';
+    
+    // 一段连续的同类操作
+    struct Run {
+        char op;
+        int length;
+        
+        Run(char o, int len) : op(o), length(len) {}
+    };
+
+public:
+    Cigar();
+    
+    /**
+     * 追加length个op操作，与最后一段同类时直接合并
+     */
+    void append(char op, int length = 1);
+    
+    // 反转段的顺序（用于从后向前回溯时生成）
+    void reverse();
+    
+    const std::vector<Run>& getRuns() const;
+    
+    bool empty() const;
+    
+    // 编辑距离：X、I、D的总长度
+    int distance() const;
+    
+    // 源串长度：=、X、D的总长度
+    int sourceLength() const;
+    
+    // 目标串长度：=、X、I的总长度
+    int targetLength() const;
+    
+    std::string toString() const;
+    
+    /**
+     * 解析"12=1X3I"格式的字符串，格式错误时抛出std::invalid_argument
+     */
+    static Cigar parse(const std::string& text);
+    
+    bool operator==(const Cigar& other) const;
+    bool operator!=(const Cigar& other) const;
+
+private:
+    std::vector<Run> runs;
+};
+
+#endif // CIGAR_H
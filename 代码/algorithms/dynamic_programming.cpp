@@ -2,9 +2,300 @@
 #include <algorithm>
 #include <climits>
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <queue>
+#include <cstring>
+#include <cstdlib>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EDIT_DISTANCE_X86_SIMD 1
+#include <immintrin.h>
+#endif
 
 using namespace std;
 
+namespace {
+
+// 从a、b开始的最长公共前缀长度（不超过limit），每次比较8个字节
+int longestCommonExtension(const char* a, const char* b, int limit) {
+    int length = 0;
+    while (length + 8 <= limit) {
+        uint64_t x, y;
+        memcpy(&x, a + length, 8);
+        memcpy(&y, b + length, 8);
+        if (x != y) break;
+        length += 8;
+    }
+    while (length < limit && a[length] == b[length]) {
+        length++;
+    }
+    return length;
+}
+
+// 反对角线d上第i行的单元格(i, d-i)只依赖d-1与d-2两条反对角线：
+//   cur[i] = min(prev1[i-1] + 删除, prev1[i] + 插入, prev2[i-1] + (a[i-1] != b[d-i-1] ? 替换 : 0))
+// pa[i] = a[i-1]，pb[i] = b[d-i-1]（b预先反转），i ∈ [lo, hi]
+template <typename Lane>
+void wavefrontStepScalar(const Lane* prev2, const Lane* prev1, Lane* cur,
+                         const char* pa, const char* pb, int lo, int hi,
+                         int insert_cost, int delete_cost, int replace_cost) {
+    for (int i = lo; i <= hi; i++) {
+        int up = prev1[i-1] + delete_cost;
+        int left = prev1[i] + insert_cost;
+        int diag = prev2[i-1] + (pa[i] != pb[i] ? replace_cost : 0);
+        cur[i] = (Lane)min(min(up, left), diag);
+    }
+}
+
+#ifdef EDIT_DISTANCE_X86_SIMD
+__attribute__((target("avx2")))
+void wavefrontStepAvx2(const int16_t* prev2, const int16_t* prev1, int16_t* cur,
+                       const char* pa, const char* pb, int lo, int hi,
+                       int insert_cost, int delete_cost, int replace_cost) {
+    const __m256i vins = _mm256_set1_epi16((short)insert_cost);
+    const __m256i vdel = _mm256_set1_epi16((short)delete_cost);
+    const __m256i vrep = _mm256_set1_epi16((short)replace_cost);
+    int i = lo;
+    for (; i + 15 <= hi; i += 16) {
+        __m256i up = _mm256_add_epi16(_mm256_loadu_si256((const __m256i*)(prev1 + i - 1)), vdel);
+        __m256i left = _mm256_add_epi16(_mm256_loadu_si256((const __m256i*)(prev1 + i)), vins);
+        __m256i diag = _mm256_loadu_si256((const __m256i*)(prev2 + i - 1));
+        __m128i eq8 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pa + i)),
+                                     _mm_loadu_si128((const __m128i*)(pb + i)));
+        __m256i eq16 = _mm256_cvtepi8_epi16(eq8);
+        diag = _mm256_add_epi16(diag, _mm256_andnot_si256(eq16, vrep));
+        _mm256_storeu_si256((__m256i*)(cur + i), _mm256_min_epi16(_mm256_min_epi16(up, left), diag));
+    }
+    wavefrontStepScalar(prev2, prev1, cur, pa, pb, i, hi, insert_cost, delete_cost, replace_cost);
+}
+
+__attribute__((target("avx2")))
+void wavefrontStepAvx2(const int32_t* prev2, const int32_t* prev1, int32_t* cur,
+                       const char* pa, const char* pb, int lo, int hi,
+                       int insert_cost, int delete_cost, int replace_cost) {
+    const __m256i vins = _mm256_set1_epi32(insert_cost);
+    const __m256i vdel = _mm256_set1_epi32(delete_cost);
+    const __m256i vrep = _mm256_set1_epi32(replace_cost);
+    int i = lo;
+    for (; i + 7 <= hi; i += 8) {
+        __m256i up = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(prev1 + i - 1)), vdel);
+        __m256i left = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(prev1 + i)), vins);
+        __m256i diag = _mm256_loadu_si256((const __m256i*)(prev2 + i - 1));
+        __m256i ca = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(pa + i)));
+        __m256i cb = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(pb + i)));
+        __m256i eq32 = _mm256_cmpeq_epi32(ca, cb);
+        diag = _mm256_add_epi32(diag, _mm256_andnot_si256(eq32, vrep));
+        _mm256_storeu_si256((__m256i*)(cur + i), _mm256_min_epi32(_mm256_min_epi32(up, left), diag));
+    }
+    wavefrontStepScalar(prev2, prev1, cur, pa, pb, i, hi, insert_cost, delete_cost, replace_cost);
+}
+
+// GCC 12的avx512fintrin.h以自赋值的_mm512_undefined_*作为直通源，内联后误报-Wmaybe-uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512bw")))
+void wavefrontStepAvx512(const int16_t* prev2, const int16_t* prev1, int16_t* cur,
+                         const char* pa, const char* pb, int lo, int hi,
+                         int insert_cost, int delete_cost, int replace_cost) {
+    const __m512i vins = _mm512_set1_epi16((short)insert_cost);
+    const __m512i vdel = _mm512_set1_epi16((short)delete_cost);
+    const __m512i vrep = _mm512_set1_epi16((short)replace_cost);
+    int i = lo;
+    for (; i + 31 <= hi; i += 32) {
+        __m512i up = _mm512_add_epi16(_mm512_loadu_si512((const void*)(prev1 + i - 1)), vdel);
+        __m512i left = _mm512_add_epi16(_mm512_loadu_si512((const void*)(prev1 + i)), vins);
+        __m512i diag = _mm512_loadu_si512((const void*)(prev2 + i - 1));
+        __m512i ca = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)(pa + i)));
+        __m512i cb = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)(pb + i)));
+        __mmask32 ne = _mm512_cmpneq_epi16_mask(ca, cb);
+        diag = _mm512_mask_add_epi16(diag, ne, diag, vrep);
+        _mm512_storeu_si512((void*)(cur + i), _mm512_min_epi16(_mm512_min_epi16(up, left), diag));
+    }
+    wavefrontStepScalar(prev2, prev1, cur, pa, pb, i, hi, insert_cost, delete_cost, replace_cost);
+}
+
+__attribute__((target("avx512bw")))
+void wavefrontStepAvx512(const int32_t* prev2, const int32_t* prev1, int32_t* cur,
+                         const char* pa, const char* pb, int lo, int hi,
+                         int insert_cost, int delete_cost, int replace_cost) {
+    const __m512i vins = _mm512_set1_epi32(insert_cost);
+    const __m512i vdel = _mm512_set1_epi32(delete_cost);
+    const __m512i vrep = _mm512_set1_epi32(replace_cost);
+    int i = lo;
+    for (; i + 15 <= hi; i += 16) {
+        __m512i up = _mm512_add_epi32(_mm512_loadu_si512((const void*)(prev1 + i - 1)), vdel);
+        __m512i left = _mm512_add_epi32(_mm512_loadu_si512((const void*)(prev1 + i)), vins);
+        __m512i diag = _mm512_loadu_si512((const void*)(prev2 + i - 1));
+        __m512i ca = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(pa + i)));
+        __m512i cb = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(pb + i)));
+        __mmask16 ne = _mm512_cmpneq_epi32_mask(ca, cb);
+        diag = _mm512_mask_add_epi32(diag, ne, diag, vrep);
+        _mm512_storeu_si512((void*)(cur + i), _mm512_min_epi32(_mm512_min_epi32(up, left), diag));
+    }
+    wavefrontStepScalar(prev2, prev1, cur, pa, pb, i, hi, insert_cost, delete_cost, replace_cost);
+}
+
+#pragma GCC diagnostic pop
+#endif
+
+// 按反对角线推进整个矩阵，a为较短的字符串（行），只保留三条反对角线
+template <typename Lane>
+int wavefrontEditDistance(const string& a, const string& b,
+                          int insert_cost, int delete_cost, int replace_cost) {
+    int m = a.length();
+    int n = b.length();
+    
+    // 额外的填充保证向量加载越过hi时不会越界
+    const int padding = 64;
+    vector<Lane> buffer[3];
+    for (int t = 0; t < 3; t++) {
+        buffer[t].assign(m + 1 + padding, 0);
+    }
+    string padded_a = " " + a + string(padding, '\0');
+    string reversed_b(b.rbegin(), b.rend());
+    reversed_b += string(m + padding, '\0');
+    
+    enum { SCALAR, AVX2, AVX512 } isa = SCALAR;
+#ifdef EDIT_DISTANCE_X86_SIMD
+    if (__builtin_cpu_supports("avx512bw")) {
+        isa = AVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        isa = AVX2;
+    }
+#endif
+    
+    Lane* prev2 = buffer[0].data();
+    Lane* prev1 = buffer[1].data();
+    Lane* cur = buffer[2].data();
+    
+    for (int d = 0; d <= m + n; d++) {
+        // 边界单元格：D[0][d]与D[d][0]
+        if (d <= n) cur[0] = (Lane)(d * insert_cost);
+        if (d <= m) cur[d] = (Lane)(d * delete_cost);
+        
+        int lo = max(1, d - n);
+        int hi = min(m, d - 1);
+        if (lo <= hi) {
+            const char* pa = padded_a.data();
+            const char* pb = reversed_b.data() + (n - d);
+            switch (isa) {
+#ifdef EDIT_DISTANCE_X86_SIMD
+                case AVX512:
+                    wavefrontStepAvx512(prev2, prev1, cur, pa, pb, lo, hi,
+                                        insert_cost, delete_cost, replace_cost);
+                    break;
+                case AVX2:
+                    wavefrontStepAvx2(prev2, prev1, cur, pa, pb, lo, hi,
+                                      insert_cost, delete_cost, replace_cost);
+                    break;
+#endif
+                default:
+                    wavefrontStepScalar(prev2, prev1, cur, pa, pb, lo, hi,
+                                        insert_cost, delete_cost, replace_cost);
+                    break;
+            }
+        }
+        
+        Lane* oldest = prev2;
+        prev2 = prev1;
+        prev1 = cur;
+        cur = oldest;
+    }
+    
+    return prev1[m];
+}
+
+// 序列间批量计算：每个SIMD通道是一个32位的Myers位向量，对应一个候选串（模式串）。
+// eq[t * lanes + l]为第l个候选与目标串第t种字符的匹配位图，text_ids为目标串各字符的种类编号；
+// 候选长度不一时，各通道用自己的末行位hbit[l]取水平差值（掩码），长度为0的通道hbit为0
+void batchGroupScalar(const uint32_t* eq, const vector<int>& text_ids, const uint32_t* hbit,
+                      int lanes, int* scores) {
+    for (int l = 0; l < lanes; l++) {
+        uint32_t pv = ~0U, mv = 0;
+        int score = scores[l];
+        for (int id : text_ids) {
+            uint32_t e = eq[(size_t)id * lanes + l];
+            uint32_t xv = e | mv;
+            uint32_t xh = (((e & pv) + pv) ^ pv) | e;
+            uint32_t ph = mv | ~(xh | pv);
+            uint32_t mh = pv & xh;
+            if (ph & hbit[l]) {
+                score++;
+            } else if (mh & hbit[l]) {
+                score--;
+            }
+            ph = (ph << 1) | 1;
+            mh <<= 1;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+        }
+        scores[l] = score;
+    }
+}
+
+#ifdef EDIT_DISTANCE_X86_SIMD
+__attribute__((target("avx2")))
+void batchGroupAvx2(const uint32_t* eq, const vector<int>& text_ids, const uint32_t* hbit,
+                    int* scores) {
+    const int lanes = 8;
+    const __m256i ones = _mm256_set1_epi32(-1);
+    const __m256i low = _mm256_set1_epi32(1);
+    const __m256i last = _mm256_loadu_si256((const __m256i*)hbit);
+    __m256i pv = ones, mv = _mm256_setzero_si256();
+    __m256i score = _mm256_loadu_si256((const __m256i*)scores);
+    for (int id : text_ids) {
+        __m256i e = _mm256_loadu_si256((const __m256i*)(eq + (size_t)id * lanes));
+        __m256i xv = _mm256_or_si256(e, mv);
+        __m256i xh = _mm256_or_si256(_mm256_xor_si256(_mm256_add_epi32(_mm256_and_si256(e, pv), pv), pv), e);
+        __m256i ph = _mm256_or_si256(mv, _mm256_xor_si256(_mm256_or_si256(xh, pv), ones));
+        __m256i mh = _mm256_and_si256(pv, xh);
+        // 比较结果为-1的通道：水平差值+1时减去-1，-1时加上-1
+        score = _mm256_sub_epi32(score, _mm256_cmpeq_epi32(_mm256_and_si256(ph, last), last));
+        score = _mm256_add_epi32(score, _mm256_cmpeq_epi32(_mm256_and_si256(mh, last), last));
+        ph = _mm256_or_si256(_mm256_slli_epi32(ph, 1), low);
+        mh = _mm256_slli_epi32(mh, 1);
+        pv = _mm256_or_si256(mh, _mm256_xor_si256(_mm256_or_si256(xv, ph), ones));
+        mv = _mm256_and_si256(ph, xv);
+    }
+    _mm256_storeu_si256((__m256i*)scores, score);
+}
+
+// 与wavefrontStepAvx512相同的头文件误报
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512bw")))
+void batchGroupAvx512(const uint32_t* eq, const vector<int>& text_ids, const uint32_t* hbit,
+                      int* scores) {
+    const int lanes = 16;
+    const __m512i ones = _mm512_set1_epi32(-1);
+    const __m512i low = _mm512_set1_epi32(1);
+    const __m512i last = _mm512_loadu_si512((const void*)hbit);
+    __m512i pv = ones, mv = _mm512_setzero_si512();
+    __m512i score = _mm512_loadu_si512((const void*)scores);
+    for (int id : text_ids) {
+        __m512i e = _mm512_loadu_si512((const void*)(eq + (size_t)id * lanes));
+        __m512i xv = _mm512_or_si512(e, mv);
+        __m512i xh = _mm512_or_si512(_mm512_xor_si512(_mm512_add_epi32(_mm512_and_si512(e, pv), pv), pv), e);
+        __m512i ph = _mm512_or_si512(mv, _mm512_xor_si512(_mm512_or_si512(xh, pv), ones));
+        __m512i mh = _mm512_and_si512(pv, xh);
+        score = _mm512_mask_add_epi32(score, _mm512_test_epi32_mask(ph, last), score, low);
+        score = _mm512_mask_sub_epi32(score, _mm512_test_epi32_mask(mh, last), score, low);
+        ph = _mm512_or_si512(_mm512_slli_epi32(ph, 1), low);
+        mh = _mm512_slli_epi32(mh, 1);
+        pv = _mm512_or_si512(mh, _mm512_xor_si512(_mm512_or_si512(xv, ph), ones));
+        mv = _mm512_and_si512(ph, xv);
+    }
+    _mm512_storeu_si512((void*)scores, score);
+}
+
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace
+
 int DynamicProgrammingEditDistance::basicEditDistance(const string& str1, const string& str2) {
     int m = str1.length();
     int n = str2.length();
@@ -41,7 +332,16 @@ int DynamicProgrammingEditDistance::basicEditDistance(const string& str1, const
 }
 
 DynamicProgrammingEditDistance::EditDistanceResult 
-DynamicProgrammingEditDistance::completeEditDistance(const string& str1, const string& str2) {
+DynamicProgrammingEditDistance::completeEditDistance(const string& str1, const string& str2,
+                                                     bool keep_dp_matrix) {
+    if (!keep_dp_matrix) {
+        long long cells = (long long)(str1.length() + 1) * (str2.length() + 1);
+        if (cells <= TRACEBACK_CELL_LIMIT) {
+            return tracebackEditDistance(str1, str2);
+        }
+        return hirschbergEditDistance(str1, str2);
+    }
+    
     auto start_time = chrono::high_resolution_clock::now();
     
     EditDistanceResult result;
@@ -86,6 +386,177 @@ DynamicProgrammingEditDistance::completeEditDistance(const string& str1, const s
     return result;
 }
 
+DynamicProgrammingEditDistance::EditDistanceResult 
+DynamicProgrammingEditDistance::tracebackEditDistance(const string& str1, const string& str2) {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    EditDistanceResult result;
+    int m = str1.length();
+    int n = str2.length();
+    
+    TracebackMatrix traceback(m + 1, n + 1);
+    result.distance = fillTraceback(str1, str2, traceback);
+    result.operations = reconstructPath(str1, str2, traceback);
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;  // 转换为毫秒
+    
+    return result;
+}
+
+int DynamicProgrammingEditDistance::fillTraceback(const string& str1, const string& str2,
+                                                  TracebackMatrix& traceback) {
+    int m = str1.length();
+    int n = str2.length();
+    
+    vector<int> prev(n + 1);
+    vector<int> curr(n + 1);
+    
+    // 边界：第0行只能插入，第0列只能删除
+    for (int j = 0; j <= n; j++) {
+        prev[j] = j;
+        if (j > 0) traceback.set(0, j, INSERT);
+    }
+    
+    for (int i = 1; i <= m; i++) {
+        curr[0] = i;
+        traceback.set(i, 0, DELETE);
+        for (int j = 1; j <= n; j++) {
+            // 与reconstructPath相同的优先级：匹配、替换、删除、插入
+            if (str1[i-1] == str2[j-1]) {
+                curr[j] = prev[j-1];
+                continue;  // MATCH编码为0，无需写入
+            }
+            int best = min({prev[j], curr[j-1], prev[j-1]});
+            curr[j] = best + 1;
+            if (prev[j-1] == best) {
+                traceback.set(i, j, REPLACE);
+            } else if (prev[j] == best) {
+                traceback.set(i, j, DELETE);
+            } else {
+                traceback.set(i, j, INSERT);
+            }
+        }
+        swap(prev, curr);
+    }
+    
+    return prev[n];
+}
+
+DynamicProgrammingEditDistance::EditDistanceResult 
+DynamicProgrammingEditDistance::hirschbergEditDistance(const string& str1, const string& str2) {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    EditDistanceResult result;
+    int m = str1.length();
+    int n = str2.length();
+    
+    // 整个矩阵的边界：D[0][j] = j，D[i][0] = i
+    vector<int> top(n + 1);
+    vector<int> left(m + 1);
+    for (int j = 0; j <= n; j++) top[j] = j;
+    for (int i = 0; i <= m; i++) left[i] = i;
+    
+    vector<char> moves;
+    moves.reserve(m + n);
+    hirschbergAlign(str1, str2, 0, m, 0, n, std::move(top), std::move(left), moves);
+    reverse(moves.begin(), moves.end());
+    
+    // 按路径生成与reconstructPath相同格式的操作序列
+    result.distance = 0;
+    result.operations.reserve(moves.size());
+    int i = 0, j = 0;
+    for (char move : moves) {
+        if (move == MOVE_DIAGONAL) {
+            if (str1[i] == str2[j]) {
+                result.operations.emplace_back(MATCH, i, j, str1[i], str2[j]);
+            } else {
+                result.operations.emplace_back(REPLACE, i, j, str1[i], str2[j]);
+                result.distance++;
+            }
+            i++; j++;
+        } else if (move == MOVE_UP) {
+            result.operations.emplace_back(DELETE, i, -1, str1[i], '\0');
+            result.distance++;
+            i++;
+        } else {
+            result.operations.emplace_back(INSERT, i, j, '\0', str2[j]);
+            result.distance++;
+            j++;
+        }
+    }
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;  // 转换为毫秒
+    
+    return result;
+}
+
+Cigar DynamicProgrammingEditDistance::cigarEditDistance(const string& str1, const string& str2) {
+    Cigar cigar;
+    int m = str1.length();
+    int n = str2.length();
+    
+    long long cells = (long long)(m + 1) * (n + 1);
+    if (cells <= TRACEBACK_CELL_LIMIT) {
+        TracebackMatrix traceback(m + 1, n + 1);
+        fillTraceback(str1, str2, traceback);
+        
+        // 从(m, n)回溯，逆序生成后整体反转
+        int i = m, j = n;
+        while (i > 0 || j > 0) {
+            switch (traceback.get(i, j)) {
+                case MATCH:
+                    cigar.append(Cigar::MATCH);
+                    i--; j--;
+                    break;
+                case REPLACE:
+                    cigar.append(Cigar::REPLACE);
+                    i--; j--;
+                    break;
+                case DELETE:
+                    cigar.append(Cigar::DELETE);
+                    i--;
+                    break;
+                case INSERT:
+                    cigar.append(Cigar::INSERT);
+                    j--;
+                    break;
+            }
+        }
+        cigar.reverse();
+        return cigar;
+    }
+    
+    vector<int> top(n + 1);
+    vector<int> left(m + 1);
+    for (int j = 0; j <= n; j++) top[j] = j;
+    for (int i = 0; i <= m; i++) left[i] = i;
+    
+    vector<char> moves;
+    moves.reserve(m + n);
+    hirschbergAlign(str1, str2, 0, m, 0, n, std::move(top), std::move(left), moves);
+    
+    // moves为逆序路径
+    int i = m, j = n;
+    for (char move : moves) {
+        if (move == MOVE_DIAGONAL) {
+            i--; j--;
+            cigar.append(str1[i] == str2[j] ? Cigar::MATCH : Cigar::REPLACE);
+        } else if (move == MOVE_UP) {
+            i--;
+            cigar.append(Cigar::DELETE);
+        } else {
+            j--;
+            cigar.append(Cigar::INSERT);
+        }
+    }
+    cigar.reverse();
+    return cigar;
+}
+
 int DynamicProgrammingEditDistance::spaceOptimizedEditDistance(const string& str1, const string& str2) {
     int m = str1.length();
     int n = str2.length();
@@ -124,6 +595,117 @@ int DynamicProgrammingEditDistance::spaceOptimizedEditDistance(const string& str
     return prev[m];
 }
 
+int DynamicProgrammingEditDistance::bitParallelEditDistance(const string& str1, const string& str2) {
+    // 较短的字符串作为模式串，每一列的垂直差值压缩在一个64位字中
+    const string& pattern = str1.length() <= str2.length() ? str1 : str2;
+    const string& text = str1.length() <= str2.length() ? str2 : str1;
+    int m = pattern.length();
+    int n = text.length();
+    
+    if (m == 0) return n;
+    if (m > 64) {
+        return blockedBitParallelEditDistance(str1, str2);
+    }
+    
+    return singleWordBitParallelWithin(pattern, text, n);
+}
+
+int DynamicProgrammingEditDistance::blockedBitParallelEditDistance(const string& str1, const string& str2) {
+    const string& pattern = str1.length() <= str2.length() ? str1 : str2;
+    const string& text = str1.length() <= str2.length() ? str2 : str1;
+    int m = pattern.length();
+    int n = text.length();
+    
+    if (m <= 64) {
+        return bitParallelEditDistance(str1, str2);
+    }
+    
+    // 从较窄的带开始，超过阈值时将带宽加倍；k >= n时结果必然精确
+    int k = max(n - m, 64);
+    while (true) {
+        int distance = blockedBitParallelWithin(pattern, text, k);
+        if (distance <= k || k >= n) {
+            return distance;
+        }
+        k = min(2 * k, n);
+    }
+}
+
+int DynamicProgrammingEditDistance::boundedEditDistance(const string& str1, const string& str2,
+                                                       int max_distance) {
+    // 较短的字符串作为行，列数n >= 行数m
+    if (str1.length() > str2.length()) {
+        return boundedEditDistance(str2, str1, max_distance);
+    }
+    
+    int m = str1.length();
+    int n = str2.length();
+    int k = max_distance;
+    int over = k + 1;  // 带外单元格及超过阈值的值统一记为k+1
+    
+    // 长度差预检查
+    if (n - m > k) return over;
+    
+    // Ukkonen带：代价不超过k的路径只经过满足 n-m-k <= j-i <= k 的单元格
+    vector<int> prev(n + 1, over);
+    vector<int> curr(n + 1, over);
+    for (int j = 0; j <= min(n, k); j++) {
+        prev[j] = j;
+    }
+    
+    for (int i = 1; i <= m; i++) {
+        int lo = max(0, i + (n - m) - k);
+        int hi = min(n, i + k);
+        int row_min = over;
+        
+        if (lo > 0) {
+            curr[lo - 1] = over;
+        }
+        for (int j = lo; j <= hi; j++) {
+            int value;
+            if (j == 0) {
+                value = i;
+            } else if (str1[i-1] == str2[j-1]) {
+                value = prev[j-1];
+            } else {
+                value = 1 + min({
+                    prev[j],        // 删除
+                    curr[j-1],      // 插入
+                    prev[j-1]       // 替换
+                });
+            }
+            curr[j] = min(value, over);
+            row_min = min(row_min, curr[j]);
+        }
+        if (hi < n) {
+            curr[hi + 1] = over;
+        }
+        
+        // 整行都超过k，最终结果不可能回到k以内
+        if (row_min > k) {
+            return over;
+        }
+        swap(prev, curr);
+    }
+    
+    return prev[n];
+}
+
+int DynamicProgrammingEditDistance::bitParallelBoundedEditDistance(const string& str1, const string& str2,
+                                                                  int max_distance) {
+    const string& pattern = str1.length() <= str2.length() ? str1 : str2;
+    const string& text = str1.length() <= str2.length() ? str2 : str1;
+    int m = pattern.length();
+    int n = text.length();
+    
+    if (n - m > max_distance) return max_distance + 1;
+    if (m == 0) return n;
+    if (m <= 64) {
+        return singleWordBitParallelWithin(pattern, text, max_distance);
+    }
+    return blockedBitParallelWithin(pattern, text, max_distance);
+}
+
 int DynamicProgrammingEditDistance::weightedEditDistance(const string& str1, const string& str2,
                                                         int insert_cost, int delete_cost, int replace_cost) {
     int m = str1.length();
@@ -157,15 +739,269 @@ int DynamicProgrammingEditDistance::weightedEditDistance(const string& str1, con
     return dp[m][n];
 }
 
+int DynamicProgrammingEditDistance::singleWordBitParallelWithin(const string& pattern, const string& text, int k) {
+    int m = pattern.length();
+    int n = text.length();
+    
+    // 模式串字符匹配位图：peq[c]的第i位表示pattern[i] == c
+    uint64_t peq[256] = {0};
+    for (int i = 0; i < m; i++) {
+        peq[(unsigned char)pattern[i]] |= 1ULL << i;
+    }
+    
+    uint64_t pv = ~0ULL;   // 垂直差值为+1的位置
+    uint64_t mv = 0;       // 垂直差值为-1的位置
+    uint64_t last = 1ULL << (m - 1);
+    int score = m;
+    
+    for (int j = 0; j < n; j++) {
+        uint64_t eq = peq[(unsigned char)text[j]];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        
+        if (ph & last) {
+            score++;
+        } else if (mh & last) {
+            score--;
+        }
+        
+        // 第0行为D[0][j] = j，水平差值恒为+1
+        ph = (ph << 1) | 1;
+        mh = mh << 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+        
+        // 剩余每一列最多使末行的值减少1，下界超过k即可提前结束
+        if (score - (n - 1 - j) > k) {
+            return k + 1;
+        }
+    }
+    
+    return score <= k ? score : k + 1;
+}
+
+int DynamicProgrammingEditDistance::advanceBlock(BitBlock& block, uint64_t eq, int hin, uint64_t hbit) {
+    uint64_t pv = block.pv;
+    uint64_t mv = block.mv;
+    uint64_t hin_neg = hin < 0 ? 1 : 0;
+    
+    uint64_t xv = eq | mv;
+    eq |= hin_neg;
+    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+    
+    int hout = 0;
+    if (ph & hbit) {
+        hout = 1;
+    } else if (mh & hbit) {
+        hout = -1;
+    }
+    
+    ph <<= 1;
+    mh <<= 1;
+    mh |= hin_neg;
+    if (hin > 0) {
+        ph |= 1;
+    }
+    
+    block.pv = mh | ~(xv | ph);
+    block.mv = ph & xv;
+    block.score += hout;
+    return hout;
+}
+
+int DynamicProgrammingEditDistance::blockedBitParallelWithin(const string& pattern, const string& text, int k) {
+    int m = pattern.length();
+    int n = text.length();
+    
+    if (n - m > k) return k + 1;
+    if (m == 0) return n;
+    
+    int num_blocks = (m + 63) / 64;
+    
+    // 只为模式串中出现的字符建立匹配位图，其余字符共用全0行
+    unsigned char char_index[256] = {0};
+    int alphabet = 1;
+    for (int i = 0; i < m; i++) {
+        unsigned char c = pattern[i];
+        if (char_index[c] == 0 && alphabet < 256) {
+            char_index[c] = alphabet++;
+        }
+    }
+    vector<uint64_t> peq((size_t)alphabet * num_blocks, 0);
+    for (int i = 0; i < m; i++) {
+        peq[(size_t)char_index[(unsigned char)pattern[i]] * num_blocks + i / 64] |= 1ULL << (i % 64);
+    }
+    
+    // 最后一块只有部分行有效，取其真实末行作为输出位
+    uint64_t last_hbit = 1ULL << ((m - 1) % 64);
+    vector<BitBlock> blocks(num_blocks);
+    
+    // 第0列：D[i][0] = i
+    blocks[0].pv = ~0ULL;
+    blocks[0].mv = 0;
+    blocks[0].score = min(64, m);
+    int first = 0;
+    int last = 0;
+    
+    for (int j = 1; j <= n; j++) {
+        // Ukkonen带：可能位于代价不超过k的路径上的行 i ∈ [j-k, j-(n-m)+k]
+        int lo_row = max(1, j - k);
+        int hi_row = min(m, j - (n - m) + k);
+        int new_first = (lo_row - 1) / 64;
+        int new_last = (hi_row - 1) / 64;
+        
+        // 新进入带内的块以上一块的底部值为基准，按垂直差值全为+1初始化（上界）
+        while (last < new_last) {
+            last++;
+            blocks[last].pv = ~0ULL;
+            blocks[last].mv = 0;
+            blocks[last].score = blocks[last - 1].score + min(64, m - last * 64);
+        }
+        // 离开带内的块不再计算，新的首块顶部水平差值按+1处理（仍是上界）
+        first = max(first, new_first);
+        
+        const uint64_t* eq = &peq[(size_t)char_index[(unsigned char)text[j-1]] * num_blocks];
+        int hin = 1;
+        bool all_above = true;
+        for (int b = first; b <= last; b++) {
+            uint64_t hbit = (b == num_blocks - 1) ? last_hbit : (1ULL << 63);
+            hin = advanceBlock(blocks[b], eq[b], hin, hbit);
+            int rows = min(64, m - b * 64);
+            if (blocks[b].score - (rows - 1) <= k) {
+                all_above = false;
+            }
+        }
+        
+        // 带内所有单元格都已超过k，最终距离不可能回到k以内
+        if (all_above) {
+            return k + 1;
+        }
+    }
+    
+    int distance = blocks[num_blocks - 1].score;
+    return distance <= k ? distance : k + 1;
+}
+
+int DynamicProgrammingEditDistance::simdEditDistance(const string& str1, const string& str2,
+                                                    int insert_cost, int delete_cost, int replace_cost) {
+    if (insert_cost < 0 || delete_cost < 0 || replace_cost < 0) {
+        return weightedEditDistance(str1, str2, insert_cost, delete_cost, replace_cost);
+    }
+    
+    // 较短的字符串作为行以减少反对角线长度；交换后插入与删除代价互换
+    if (str1.length() > str2.length()) {
+        return simdEditDistance(str2, str1, delete_cost, insert_cost, replace_cost);
+    }
+    
+    // 任何单元格都不超过"全部删除再全部插入"的代价，加上一次操作代价即为中间结果上界
+    long long bound = (long long)str1.length() * delete_cost + (long long)str2.length() * insert_cost
+                    + max(max(insert_cost, delete_cost), replace_cost);
+    if (bound <= INT16_MAX) {
+        return wavefrontEditDistance<int16_t>(str1, str2, insert_cost, delete_cost, replace_cost);
+    }
+    if (bound <= INT32_MAX) {
+        return wavefrontEditDistance<int32_t>(str1, str2, insert_cost, delete_cost, replace_cost);
+    }
+    return weightedEditDistance(str1, str2, insert_cost, delete_cost, replace_cost);
+}
+
+int DynamicProgrammingEditDistance::diagonalTransitionEditDistance(const string& str1, const string& str2,
+                                                                   int max_distance) {
+    int distance = diagonalTransitionBoundedEditDistance(str1, str2, max_distance);
+    if (max_distance >= 0 && distance > max_distance) {
+        // 差异超出预期，改用不依赖距离大小的位并行DP
+        return bitParallelEditDistance(str1, str2);
+    }
+    return distance;
+}
+
+int DynamicProgrammingEditDistance::diagonalTransitionBoundedEditDistance(const string& str1, const string& str2,
+                                                                          int max_distance) {
+    int m = str1.length();
+    int n = str2.length();
+    if (max_distance >= 0 && abs(m - n) > max_distance) {
+        return max_distance + 1;
+    }
+    const char* a = str1.data();
+    const char* b = str2.data();
+    
+    // furthest[d + m + 1]为对角线d = j - i上当前错误数下能到达的最远行i，对角线范围[-m, n]外留一格哨兵
+    const int UNREACHED = INT_MIN / 2;
+    int offset = m + 1;
+    vector<int> furthest(m + n + 3, UNREACHED);
+    vector<int> next(m + n + 3, UNREACHED);
+    
+    int target_diagonal = n - m;
+    furthest[offset] = longestCommonExtension(a, b, min(m, n));
+    if (target_diagonal == 0 && furthest[offset] == m) {
+        return 0;
+    }
+    
+    for (int e = 1; ; e++) {
+        if (max_distance >= 0 && e > max_distance) {
+            return max_distance + 1;
+        }
+        
+        int low = max(-e, -m), high = min(e, n);
+        // 上一轮只覆盖了[low+1, high-1]附近的对角线，边界外保持哨兵
+        for (int d = low; d <= high; d++) {
+            int k = d + offset;
+            int row = max(furthest[k] + 1,              // 替换
+                          max(furthest[k + 1] + 1,      // 删除：来自对角线d+1
+                              furthest[k - 1]));        // 插入：来自对角线d-1
+            row = min(row, min(m, n - d));
+            if (row < max(0, -d)) {
+                next[k] = UNREACHED;
+                continue;
+            }
+            int limit = min(m - row, n - d - row);
+            row += longestCommonExtension(a + row, b + row + d, limit);
+            next[k] = row;
+            
+            if (d == target_diagonal && row == m) {
+                return e;
+            }
+        }
+        for (int d = low; d <= high; d++) {
+            furthest[d + offset] = next[d + offset];
+        }
+    }
+}
+
 vector<pair<string, int>> DynamicProgrammingEditDistance::batchEditDistance(
     const string& target, const vector<string>& candidates) {
     
     vector<pair<string, int>> results;
     results.reserve(candidates.size());
     
+    vector<int> distances = simdBatchEditDistance(target, candidates);
+    for (size_t i = 0; i < candidates.size(); i++) {
+        results.emplace_back(candidates[i], distances[i]);
+    }
+    
+    // 按编辑距离排序
+    sort(results.begin(), results.end(), 
+         [](const pair<string, int>& a, const pair<string, int>& b) {
+             return a.second < b.second;
+         });
+    
+    return results;
+}
+
+vector<pair<string, int>> DynamicProgrammingEditDistance::batchEditDistance(
+    const string& target, const vector<string>& candidates, int max_distance) {
+    
+    vector<pair<string, int>> results;
+    
     for (const auto& candidate : candidates) {
-        int distance = basicEditDistance(target, candidate);
-        results.emplace_back(candidate, distance);
+        int distance = bitParallelBoundedEditDistance(target, candidate, max_distance);
+        if (distance <= max_distance) {
+            results.emplace_back(candidate, distance);
+        }
     }
     
     // 按编辑距离排序
@@ -177,6 +1013,289 @@ vector<pair<string, int>> DynamicProgrammingEditDistance::batchEditDistance(
     return results;
 }
 
+vector<int> DynamicProgrammingEditDistance::simdBatchEditDistance(
+    const string& target, const vector<string>& candidates) {
+    
+    vector<int> distances(candidates.size());
+    int n = target.length();
+    
+    int lanes = 8;
+    enum { SCALAR, AVX2, AVX512 } isa = SCALAR;
+#ifdef EDIT_DISTANCE_X86_SIMD
+    if (__builtin_cpu_supports("avx512bw")) {
+        isa = AVX512;
+        lanes = 16;
+    } else if (__builtin_cpu_supports("avx2")) {
+        isa = AVX2;
+    }
+#endif
+    
+    // 目标串的字符种类编号，匹配位图只需为这些字符建立
+    int char_id[256];
+    fill(char_id, char_id + 256, -1);
+    vector<unsigned char> alphabet;
+    vector<int> text_ids(n);
+    for (int j = 0; j < n; j++) {
+        unsigned char c = target[j];
+        if (char_id[c] < 0) {
+            char_id[c] = alphabet.size();
+            alphabet.push_back(c);
+        }
+        text_ids[j] = char_id[c];
+    }
+    
+    // 位向量的更新代价与候选长度无关，短候选按原顺序分组即可；更长的候选使用位并行算法
+    vector<int> order;
+    order.reserve(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if ((int)candidates[i].length() <= SIMD_BATCH_MAX_LENGTH) {
+            order.push_back((int)i);
+        } else {
+            distances[i] = bitParallelEditDistance(target, candidates[i]);
+        }
+    }
+    
+    vector<uint32_t> eq(max((size_t)1, alphabet.size()) * lanes);
+    vector<uint32_t> hbit(lanes);
+    vector<int> scores(lanes);
+    for (size_t group = 0; group < order.size(); group += lanes) {
+        // 交错写入各通道的匹配位图，不足的通道视为空串
+        fill(eq.begin(), eq.end(), 0);
+        for (int l = 0; l < lanes; l++) {
+            hbit[l] = 0;
+            scores[l] = 0;
+            if (group + l >= order.size()) continue;
+            const string& candidate = candidates[order[group + l]];
+            for (size_t i = 0; i < candidate.length(); i++) {
+                int id = char_id[(unsigned char)candidate[i]];
+                if (id >= 0) {
+                    eq[(size_t)id * lanes + l] |= 1U << i;
+                }
+            }
+            if (!candidate.empty()) {
+                hbit[l] = 1U << (candidate.length() - 1);
+                scores[l] = candidate.length();
+            }
+        }
+        
+        switch (isa) {
+#ifdef EDIT_DISTANCE_X86_SIMD
+            case AVX512:
+                batchGroupAvx512(eq.data(), text_ids, hbit.data(), scores.data());
+                break;
+            case AVX2:
+                batchGroupAvx2(eq.data(), text_ids, hbit.data(), scores.data());
+                break;
+#endif
+            default:
+                batchGroupScalar(eq.data(), text_ids, hbit.data(), lanes, scores.data());
+                break;
+        }
+        
+        for (int l = 0; l < lanes && group + l < order.size(); l++) {
+            const string& candidate = candidates[order[group + l]];
+            distances[order[group + l]] = candidate.empty() ? n : scores[l];
+        }
+    }
+    
+    return distances;
+}
+
+vector<int> DynamicProgrammingEditDistance::prefixSharingBatchEditDistance(
+    const string& target, const vector<string>& candidates, int max_distance) {
+    
+    vector<int> distances(candidates.size());
+    int n = target.length();
+    
+    vector<int> order(candidates.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    sort(order.begin(), order.end(), [&](int a, int b) {
+        return candidates[a] < candidates[b];
+    });
+    
+    // rows[d]为候选前d个字符对目标串的DP行，rows[0]为初始行
+    vector<vector<int>> rows(1, vector<int>(n + 1));
+    for (int j = 0; j <= n; j++) {
+        rows[0][j] = j;
+    }
+    
+    const string* previous = nullptr;
+    int valid_depth = 0;    // 上一个候选已计算的行数
+    int pruned_depth = -1;  // 上一个候选在该深度被剪枝，-1表示未剪枝
+    
+    for (int index : order) {
+        const string& candidate = candidates[index];
+        int m = candidate.length();
+        
+        int common = 0;
+        if (previous != nullptr) {
+            int limit = min(m, (int)previous->length());
+            while (common < limit && candidate[common] == (*previous)[common]) {
+                common++;
+            }
+        }
+        previous = &candidate;
+        
+        // 与上一个候选共享被剪枝的前缀，整棵子树都超过阈值
+        if (pruned_depth >= 0 && common >= pruned_depth) {
+            distances[index] = max_distance + 1;
+            continue;
+        }
+        pruned_depth = -1;
+        
+        int depth = min(common, valid_depth);
+        if ((int)rows.size() <= m) {
+            rows.resize(m + 1, vector<int>(n + 1));
+        }
+        
+        for (int i = depth + 1; i <= m; i++) {
+            const vector<int>& prev = rows[i - 1];
+            vector<int>& curr = rows[i];
+            char c = candidate[i - 1];
+            curr[0] = i;
+            int row_min = curr[0];
+            for (int j = 1; j <= n; j++) {
+                int best = prev[j - 1] + (c == target[j - 1] ? 0 : 1);
+                best = min(best, min(prev[j], curr[j - 1]) + 1);
+                curr[j] = best;
+                row_min = min(row_min, best);
+            }
+            depth = i;
+            if (max_distance >= 0 && row_min > max_distance) {
+                pruned_depth = i;
+                break;
+            }
+        }
+        valid_depth = depth;
+        
+        if (pruned_depth >= 0) {
+            distances[index] = max_distance + 1;
+        } else if (max_distance >= 0) {
+            distances[index] = min(rows[m][n], max_distance + 1);
+        } else {
+            distances[index] = rows[m][n];
+        }
+    }
+    
+    return distances;
+}
+
+vector<DynamicProgrammingEditDistance::BatchMatch> DynamicProgrammingEditDistance::parallelBatchEditDistance(
+    const string& target, const vector<string>& candidates, int num_threads) {
+    
+    vector<int> distances(candidates.size());
+    runWorkerPool(candidates.size(), num_threads, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            distances[i] = bitParallelEditDistance(target, candidates[i]);
+        }
+    });
+    
+    // 距离是有界小整数，用计数排序代替比较排序，同距离的候选保持下标顺序
+    int max_distance = 0;
+    for (int distance : distances) {
+        max_distance = max(max_distance, distance);
+    }
+    vector<size_t> offsets(max_distance + 2, 0);
+    for (int distance : distances) {
+        offsets[distance + 1]++;
+    }
+    for (int d = 1; d <= max_distance + 1; d++) {
+        offsets[d] += offsets[d - 1];
+    }
+    
+    vector<BatchMatch> results(candidates.size());
+    for (size_t i = 0; i < distances.size(); i++) {
+        results[offsets[distances[i]]++] = BatchMatch((int)i, distances[i]);
+    }
+    return results;
+}
+
+vector<DynamicProgrammingEditDistance::BatchMatch> DynamicProgrammingEditDistance::topKEditDistance(
+    const string& target, const vector<string>& candidates, int k, int num_threads) {
+    
+    if (k <= 0 || candidates.empty()) {
+        return vector<BatchMatch>();
+    }
+    
+    // 每个线程一个大顶堆，堆顶为当前第k好的候选
+    typedef priority_queue<BatchMatch> BoundedHeap;
+    int max_threads = num_threads > 0 ? num_threads : max(1, (int)thread::hardware_concurrency());
+    vector<BoundedHeap> heaps(max_threads);
+    
+    int used_threads = runWorkerPool(candidates.size(), num_threads, [&](int thread_id, size_t begin, size_t end) {
+        BoundedHeap& heap = heaps[thread_id];
+        for (size_t i = begin; i < end; i++) {
+            if ((int)heap.size() < k) {
+                heap.push(BatchMatch((int)i, bitParallelEditDistance(target, candidates[i])));
+                continue;
+            }
+            // 堆已满：只需判断是否不超过当前第k名的距离
+            int threshold = heap.top().distance;
+            int distance = bitParallelBoundedEditDistance(target, candidates[i], threshold);
+            BatchMatch match((int)i, distance);
+            if (distance <= threshold && match < heap.top()) {
+                heap.pop();
+                heap.push(match);
+            }
+        }
+    });
+    
+    // 合并各线程的堆
+    BoundedHeap merged;
+    for (int t = 0; t < used_threads; t++) {
+        while (!heaps[t].empty()) {
+            const BatchMatch& match = heaps[t].top();
+            if ((int)merged.size() < k) {
+                merged.push(match);
+            } else if (match < merged.top()) {
+                merged.pop();
+                merged.push(match);
+            }
+            heaps[t].pop();
+        }
+    }
+    
+    vector<BatchMatch> results(merged.size());
+    for (int i = (int)results.size() - 1; i >= 0; i--) {
+        results[i] = merged.top();
+        merged.pop();
+    }
+    return results;
+}
+
+int DynamicProgrammingEditDistance::runWorkerPool(size_t count, int num_threads,
+                                                  const function<void(int, size_t, size_t)>& worker) {
+    if (num_threads <= 0) {
+        num_threads = max(1, (int)thread::hardware_concurrency());
+    }
+    size_t chunks = (count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+    num_threads = (int)min((size_t)num_threads, max((size_t)1, chunks));
+    
+    // 动态领取任务块，避免候选长度不均导致线程负载不平衡
+    atomic<size_t> next_chunk(0);
+    auto run = [&](int thread_id) {
+        while (true) {
+            size_t chunk = next_chunk.fetch_add(1);
+            if (chunk >= chunks) break;
+            size_t begin = chunk * BATCH_CHUNK_SIZE;
+            size_t end = min(count, begin + BATCH_CHUNK_SIZE);
+            worker(thread_id, begin, end);
+        }
+    };
+    
+    vector<thread> workers;
+    for (int t = 1; t < num_threads; t++) {
+        workers.emplace_back(run, t);
+    }
+    run(0);
+    for (auto& worker_thread : workers) {
+        worker_thread.join();
+    }
+    return num_threads;
+}
+
 vector<DynamicProgrammingEditDistance::EditOperation> 
 DynamicProgrammingEditDistance::reconstructPath(const string& str1, const string& str2,
                                                const vector<vector<int>>& dp) {
@@ -209,6 +1328,211 @@ DynamicProgrammingEditDistance::reconstructPath(const string& str1, const string
     return operations;
 }
 
+DynamicProgrammingEditDistance::PathMove 
+DynamicProgrammingEditDistance::tracebackMove(const string& str1, const string& str2, int i, int j,
+                                              const vector<int>& prev, const vector<int>& curr, int x) {
+    if (str1[i-1] == str2[j-1]) {
+        return MOVE_DIAGONAL;   // 匹配
+    }
+    if (curr[x] == prev[x-1] + 1) {
+        return MOVE_DIAGONAL;   // 替换
+    }
+    if (curr[x] == prev[x] + 1) {
+        return MOVE_UP;         // 删除
+    }
+    return MOVE_LEFT;           // 插入
+}
+
+void DynamicProgrammingEditDistance::hirschbergAlign(const string& str1, const string& str2,
+                                                     int r0, int r1, int c0, int c1,
+                                                     vector<int> top, vector<int> left,
+                                                     vector<char>& moves) {
+    int rows = r1 - r0;
+    int cols = c1 - c0;
+    
+    if (rows == 0) {
+        moves.insert(moves.end(), cols, MOVE_LEFT);
+        return;
+    }
+    if (cols == 0) {
+        moves.insert(moves.end(), rows, MOVE_UP);
+        return;
+    }
+    
+    // 计算矩形内第i行（第r0行由top给出）
+    auto computeRow = [&](int i, const vector<int>& prev, vector<int>& curr, int width) {
+        curr[0] = left[i - r0];
+        for (int x = 1; x <= width; x++) {
+            int j = c0 + x;
+            if (str1[i-1] == str2[j-1]) {
+                curr[x] = prev[x-1];
+            } else {
+                curr[x] = 1 + min({prev[x], curr[x-1], prev[x-1]});
+            }
+        }
+    };
+    
+    // 规模较小时直接保存整个子矩阵并回溯
+    if (rows == 1 || (long long)(rows + 1) * (cols + 1) <= 4096) {
+        vector<vector<int>> block(rows + 1, vector<int>(cols + 1));
+        block[0] = top;
+        for (int i = r0 + 1; i <= r1; i++) {
+            computeRow(i, block[i - r0 - 1], block[i - r0], cols);
+        }
+        
+        // 路径必然经过(r0, c0)：左边界上只能向上，上边界上只能向左
+        int i = r1, j = c1;
+        while (i > r0 || j > c0) {
+            PathMove move;
+            if (j == c0) {
+                move = MOVE_UP;
+            } else if (i == r0) {
+                move = MOVE_LEFT;
+            } else {
+                move = tracebackMove(str1, str2, i, j, block[i - r0 - 1], block[i - r0], j - c0);
+            }
+            moves.push_back(move);
+            if (move != MOVE_LEFT) i--;
+            if (move != MOVE_UP) j--;
+        }
+        return;
+    }
+    
+    int mid = r0 + rows / 2;
+    
+    // 前向扫描：hit[x]记录从第i行的单元格回溯时首次到达第mid行的列
+    vector<int> prev(top);
+    vector<int> curr(cols + 1);
+    vector<int> mid_row;
+    vector<int> hit_prev(cols + 1);
+    vector<int> hit_curr(cols + 1);
+    for (int i = r0 + 1; i <= r1; i++) {
+        computeRow(i, prev, curr, cols);
+        if (i == mid) {
+            mid_row = curr;
+        } else if (i > mid) {
+            for (int x = 0; x <= cols; x++) {
+                int j = c0 + x;
+                PathMove move = (x == 0) ? MOVE_UP : tracebackMove(str1, str2, i, j, prev, curr, x);
+                if (move == MOVE_LEFT) {
+                    hit_curr[x] = hit_curr[x-1];
+                } else {
+                    int px = (move == MOVE_DIAGONAL) ? x - 1 : x;
+                    hit_curr[x] = (i - 1 == mid) ? c0 + px : hit_prev[px];
+                }
+            }
+            swap(hit_prev, hit_curr);
+        }
+        swap(prev, curr);
+    }
+    int c = hit_prev[cols];
+    
+    // 第二次扫描得到第c列在[mid, r1]行的值，作为下半部分的左边界
+    int width = c - c0;
+    vector<int> lower_left(r1 - mid + 1);
+    lower_left[0] = mid_row[width];
+    prev.assign(mid_row.begin(), mid_row.begin() + width + 1);
+    curr.assign(width + 1, 0);
+    for (int i = mid + 1; i <= r1; i++) {
+        computeRow(i, prev, curr, width);
+        lower_left[i - mid] = curr[width];
+        swap(prev, curr);
+    }
+    
+    vector<int> lower_top(mid_row.begin() + width, mid_row.end());
+    vector<int> upper_top(top.begin(), top.begin() + width + 1);
+    vector<int> upper_left(left.begin(), left.begin() + (mid - r0) + 1);
+    
+    // 释放本层缓冲后再递归，各层保留的边界互不重叠，总空间保持线性
+    vector<int>().swap(top);
+    vector<int>().swap(left);
+    vector<int>().swap(prev);
+    vector<int>().swap(curr);
+    vector<int>().swap(mid_row);
+    vector<int>().swap(hit_prev);
+    vector<int>().swap(hit_curr);
+    
+    hirschbergAlign(str1, str2, mid, r1, c, c1, std::move(lower_top), std::move(lower_left), moves);
+    hirschbergAlign(str1, str2, r0, mid, c0, c, std::move(upper_top), std::move(upper_left), moves);
+}
+
+vector<DynamicProgrammingEditDistance::EditOperation> 
+DynamicProgrammingEditDistance::reconstructPath(const string& str1, const string& str2,
+                                               const TracebackMatrix& traceback) {
+    vector<EditOperation> operations;
+    int i = str1.length();
+    int j = str2.length();
+    
+    while (i > 0 || j > 0) {
+        switch (traceback.get(i, j)) {
+            case MATCH:
+                operations.emplace_back(MATCH, i-1, j-1, str1[i-1], str2[j-1]);
+                i--; j--;
+                break;
+            case REPLACE:
+                operations.emplace_back(REPLACE, i-1, j-1, str1[i-1], str2[j-1]);
+                i--; j--;
+                break;
+            case DELETE:
+                operations.emplace_back(DELETE, i-1, -1, str1[i-1], '\0');
+                i--;
+                break;
+            case INSERT:
+                operations.emplace_back(INSERT, i, j-1, '\0', str2[j-1]);
+                j--;
+                break;
+        }
+    }
+    
+    // 反转操作序列，使其按正确顺序排列
+    reverse(operations.begin(), operations.end());
+    return operations;
+}
+
+Cigar DynamicProgrammingEditDistance::toCigar(const vector<EditOperation>& operations) {
+    Cigar cigar;
+    for (const auto& op : operations) {
+        switch (op.op) {
+            case MATCH:   cigar.append(Cigar::MATCH); break;
+            case REPLACE: cigar.append(Cigar::REPLACE); break;
+            case DELETE:  cigar.append(Cigar::DELETE); break;
+            case INSERT:  cigar.append(Cigar::INSERT); break;
+        }
+    }
+    return cigar;
+}
+
+vector<DynamicProgrammingEditDistance::EditOperation> 
+DynamicProgrammingEditDistance::fromCigar(const Cigar& cigar, const string& str1, const string& str2) {
+    vector<EditOperation> operations;
+    operations.reserve(cigar.sourceLength() + cigar.targetLength());
+    
+    int i = 0, j = 0;
+    for (const auto& run : cigar.getRuns()) {
+        for (int k = 0; k < run.length; k++) {
+            switch (run.op) {
+                case Cigar::MATCH:
+                    operations.emplace_back(MATCH, i, j, str1[i], str2[j]);
+                    i++; j++;
+                    break;
+                case Cigar::REPLACE:
+                    operations.emplace_back(REPLACE, i, j, str1[i], str2[j]);
+                    i++; j++;
+                    break;
+                case Cigar::DELETE:
+                    operations.emplace_back(DELETE, i, -1, str1[i], '\0');
+                    i++;
+                    break;
+                case Cigar::INSERT:
+                    operations.emplace_back(INSERT, i, j, '\0', str2[j]);
+                    j++;
+                    break;
+            }
+        }
+    }
+    return operations;
+}
+
 string DynamicProgrammingEditDistance::getOperationString(const EditOperation& op) {
     switch (op.op) {
         case MATCH:
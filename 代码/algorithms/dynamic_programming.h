@@ -4,6 +4,9 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <cstdint>
+#include <functional>
+#include "cigar.h"
 
 /**
  * 动态规划编辑距离算法实现
@@ -35,6 +38,37 @@ public:
         std::vector<std::vector<int>> dp_matrix; // DP矩阵（用于分析）
         double computation_time;                // 计算时间（毫秒）
     };
+    
+    // 批量计算结果：候选字符串的下标及其编辑距离
+    struct BatchMatch {
+        int index;
+        int distance;
+        
+        BatchMatch(int i = 0, int d = 0) : index(i), distance(d) {}
+        
+        bool operator<(const BatchMatch& other) const {
+            return distance != other.distance ? distance < other.distance : index < other.index;
+        }
+    };
+    
+    // 紧凑回溯矩阵：每个单元格用2位记录回溯时选择的操作
+    struct TracebackMatrix {
+        int rows, cols;                 // (m+1) x (n+1)
+        std::vector<uint8_t> cells;     // 每字节4个单元格
+        
+        TracebackMatrix(int r, int c)
+            : rows(r), cols(c), cells(((size_t)r * c + 3) / 4, 0) {}
+        
+        Operation get(int i, int j) const {
+            size_t index = (size_t)i * cols + j;
+            return (Operation)((cells[index >> 2] >> ((index & 3) * 2)) & 3);
+        }
+        
+        void set(int i, int j, Operation op) {
+            size_t index = (size_t)i * cols + j;
+            cells[index >> 2] |= (uint8_t)(op << ((index & 3) * 2));
+        }
+    };
 
 public:
     /**
@@ -46,10 +80,36 @@ public:
     
     /**
      * 完整动态规划算法 - 计算编辑距离并记录操作路径
+     * 默认不保存DP矩阵：中等规模使用2位回溯矩阵，更大规模使用Hirschberg线性空间算法；
+     * keep_dp_matrix为true时保存完整DP矩阵（仅用于分析）
      * 时间复杂度: O(m*n)
-     * 空间复杂度: O(m*n)
+     * 空间复杂度: O(m*n/4)字节或O(m+n)，保存矩阵时为O(m*n)个int
+     */
+    static EditDistanceResult completeEditDistance(const std::string& str1, const std::string& str2,
+                                                   bool keep_dp_matrix = false);
+    
+    /**
+     * 紧凑回溯算法 - 只保存每个单元格2位的回溯方向，比保存int矩阵节省16倍内存
+     * 操作序列与reconstructPath一致
+     * 时间复杂度: O(m*n)
+     * 空间复杂度: O(m*n/4)字节
+     */
+    static EditDistanceResult tracebackEditDistance(const std::string& str1, const std::string& str2);
+    
+    /**
+     * Hirschberg分治算法 - 线性空间内求出编辑距离和操作序列
+     * 每层用前向扫描记录回溯路径穿过中间行的位置，操作序列与reconstructPath一致
+     * 时间复杂度: O(m*n)
+     * 空间复杂度: O(m+n)
+     */
+    static EditDistanceResult hirschbergEditDistance(const std::string& str1, const std::string& str2);
+    
+    /**
+     * 直接输出游程编码的操作序列（与completeEditDistance的路径相同），不构造逐字符的操作数组
+     * 时间复杂度: O(m*n)
+     * 空间复杂度: O(m*n/4)字节或O(m+n)，另加段数
      */
-    static EditDistanceResult completeEditDistance(const std::string& str1, const std::string& str2);
+    static Cigar cigarEditDistance(const std::string& str1, const std::string& str2);
     
     /**
      * 空间优化的动态规划算法 - 只使用O(min(m,n))空间
@@ -58,17 +118,119 @@ public:
      */
     static int spaceOptimizedEditDistance(const std::string& str1, const std::string& str2);
     
+    /**
+     * 位并行动态规划算法（Myers/Hyyrö）- 一个机器字同时计算64个单元格
+     * 较短字符串作为模式串，超过64个字符时交给分块位并行算法
+     * 时间复杂度: O(max(m,n))（min(m,n) <= 64时），否则O(n*⌈m/64⌉)，带内为O(n*d/64)
+     * 空间复杂度: O(σ)，分块时O(m/64 + σ)
+     */
+    static int bitParallelEditDistance(const std::string& str1, const std::string& str2);
+    
+    /**
+     * 分块位并行算法 - 模式串按64位分块，块间传递水平差值
+     * 只处理Ukkonen带内的块，阈值k按倍增方式逐步放宽
+     * 时间复杂度: O(n*d/64)（d为编辑距离）
+     * 空间复杂度: O(min(m,n)/64 + σ)
+     */
+    static int blockedBitParallelEditDistance(const std::string& str1, const std::string& str2);
+    
+    /**
+     * 带阈值的编辑距离算法 - 只判断距离是否不超过k
+     * 先做长度差预检查，只计算2k+1宽的对角带，整行都超过k时立即结束
+     * 返回值: 距离不超过k时为精确距离，否则为k+1（不计算精确值）
+     * 时间复杂度: O(k*min(m,n))
+     * 空间复杂度: O(max(m,n))
+     */
+    static int boundedEditDistance(const std::string& str1, const std::string& str2, int max_distance);
+    
+    /**
+     * 带阈值的位并行算法 - 短模式串使用单字核心，长模式串只处理带内的块
+     * 返回值约定与boundedEditDistance相同
+     * 时间复杂度: O(n*k/64)
+     */
+    static int bitParallelBoundedEditDistance(const std::string& str1, const std::string& str2,
+                                              int max_distance);
+    
     /**
      * 加权编辑距离算法 - 支持不同操作的权重
      */
     static int weightedEditDistance(const std::string& str1, const std::string& str2,
                                    int insert_cost = 1, int delete_cost = 1, int replace_cost = 1);
     
+    /**
+     * 反对角线（波前）SIMD算法 - 同一反对角线上的单元格互不依赖，可整体向量化
+     * 支持任意非负的插入/删除/替换代价，按不会溢出的最窄宽度选择16位或32位通道
+     * 运行时检测AVX-512BW/AVX2，不支持时使用标量实现
+     * 时间复杂度: O(m*n/通道数)
+     * 空间复杂度: O(min(m,n))
+     */
+    static int simdEditDistance(const std::string& str1, const std::string& str2,
+                                int insert_cost = 1, int delete_cost = 1, int replace_cost = 1);
+    
+    /**
+     * 对角线转移算法（Landau-Vishkin / O(ND)）- 适合差异很少的长字符串
+     * 对每个错误数e记录各对角线上能到达的最远行，再沿对角线按8字节一组比较延伸公共部分
+     * max_distance非负时，距离超过它即交给位并行DP计算精确值
+     * 时间复杂度: O((m+n)*d)，最坏情况下受max_distance限制
+     * 空间复杂度: O(m+n)
+     */
+    static int diagonalTransitionEditDistance(const std::string& str1, const std::string& str2,
+                                              int max_distance = -1);
+    
+    /**
+     * 带阈值的对角线转移算法 - 错误数超过max_distance时立即停止
+     * 返回值约定与boundedEditDistance相同，max_distance为负时不设阈值
+     * 时间复杂度: O(n + k^2)（期望），最坏O((m+n)*k)
+     * 空间复杂度: O(m+n)
+     */
+    static int diagonalTransitionBoundedEditDistance(const std::string& str1, const std::string& str2,
+                                                     int max_distance);
+    
     /**
      * 批量计算编辑距离 - 一个目标字符串与多个候选字符串
      */
     static std::vector<std::pair<std::string, int>> batchEditDistance(
         const std::string& target, const std::vector<std::string>& candidates);
+    
+    /**
+     * 带阈值的批量计算 - 只返回编辑距离不超过max_distance的候选字符串
+     */
+    static std::vector<std::pair<std::string, int>> batchEditDistance(
+        const std::string& target, const std::vector<std::string>& candidates, int max_distance);
+    
+    /**
+     * 序列间SIMD批量计算 - 一个目标串对多个短候选串
+     * 每8个（AVX2）或16个（AVX-512）候选一组交错放入SIMD通道，每个32位通道独立运行一个候选的位并行DP，
+     * 长度不一的候选各自用末行掩码取结果，超过32个字符的候选交给位并行算法
+     * 返回值与candidates一一对应
+     */
+    static std::vector<int> simdBatchEditDistance(
+        const std::string& target, const std::vector<std::string>& candidates);
+    
+    /**
+     * 共享前缀批量计算 - 候选按字典序排序后，相邻候选的公共前缀部分复用DP行
+     * 以候选前缀长度为键保存一栈DP行，每个候选只计算公共前缀之后的行；
+     * max_distance非负时，某行最小值超过阈值即剪掉共享该前缀的所有候选，其距离记为max_distance+1
+     * 返回值与candidates一一对应
+     * 时间复杂度: O(字典树节点数*n)
+     * 空间复杂度: O(最长候选长度*n)
+     */
+    static std::vector<int> prefixSharingBatchEditDistance(
+        const std::string& target, const std::vector<std::string>& candidates, int max_distance = -1);
+    
+    /**
+     * 多线程批量计算 - 候选列表按块分配给工作线程，结果只保存下标和距离
+     * 结果按(距离, 下标)排序，num_threads为0时使用硬件线程数
+     */
+    static std::vector<BatchMatch> parallelBatchEditDistance(
+        const std::string& target, const std::vector<std::string>& candidates, int num_threads = 0);
+    
+    /**
+     * 多线程Top-K查询 - 每个线程维护大小为k的有界堆，以堆顶距离作为阈值剪枝
+     * 返回距离最小的k个候选，按(距离, 下标)排序
+     */
+    static std::vector<BatchMatch> topKEditDistance(
+        const std::string& target, const std::vector<std::string>& candidates, int k, int num_threads = 0);
 
 public:
     // 辅助函数：从DP矩阵重构操作序列
@@ -76,8 +238,70 @@ public:
         const std::string& str1, const std::string& str2,
         const std::vector<std::vector<int>>& dp);
     
+    // 辅助函数：沿紧凑回溯矩阵重构操作序列
+    static std::vector<EditOperation> reconstructPath(
+        const std::string& str1, const std::string& str2,
+        const TracebackMatrix& traceback);
+    
     // 辅助函数：获取操作描述字符串
     static std::string getOperationString(const EditOperation& op);
+    
+    // 辅助函数：操作序列转为游程编码
+    static Cigar toCigar(const std::vector<EditOperation>& operations);
+    
+    // 辅助函数：游程编码还原为操作序列（格式与reconstructPath相同）
+    static std::vector<EditOperation> fromCigar(const Cigar& cigar,
+                                                const std::string& str1, const std::string& str2);
+
+    // 默认模式下使用紧凑回溯矩阵的最大单元格数（约16MB），超过后改用Hirschberg
+    static const long long TRACEBACK_CELL_LIMIT = 1LL << 26;
+    
+private:
+    // 位并行分块：每块保存一列中64行的垂直差值及块底部单元格的值
+    struct BitBlock {
+        uint64_t pv, mv;
+        int score;
+    };
+    
+    // 序列间SIMD批量计算处理的最大候选长度，更长的候选使用位并行算法
+    static const int SIMD_BATCH_MAX_LENGTH = 32;
+    
+    // 批量计算时每次分配给工作线程的候选数量
+    static const int BATCH_CHUNK_SIZE = 1024;
+    
+    // 启动工作线程，按块领取[0, count)中的任务并调用worker(thread_id, begin, end)
+    static int runWorkerPool(size_t count, int num_threads,
+                             const std::function<void(int, size_t, size_t)>& worker);
+    
+    // 单字位并行核心（pattern长度1~64且不长于text），距离超过k时返回k+1
+    static int singleWordBitParallelWithin(const std::string& pattern, const std::string& text, int k);
+    
+    // 推进一个块到下一列，hin/返回值为块顶部/底部的水平差值(-1, 0, +1)
+    static int advanceBlock(BitBlock& block, uint64_t eq, int hin, uint64_t hbit);
+    
+    // 回溯路径上的一步：对角(匹配/替换)、向上(删除)、向左(插入)
+    enum PathMove : char {
+        MOVE_DIAGONAL = 'M',
+        MOVE_UP = 'D',
+        MOVE_LEFT = 'I'
+    };
+    
+    // 填充紧凑回溯矩阵，返回编辑距离
+    static int fillTraceback(const std::string& str1, const std::string& str2, TracebackMatrix& traceback);
+    
+    // 按reconstructPath的优先级选择(i, j)的前驱；prev/curr为第i-1/i行，x为列在行缓冲中的下标
+    static PathMove tracebackMove(const std::string& str1, const std::string& str2, int i, int j,
+                                  const std::vector<int>& prev, const std::vector<int>& curr, int x);
+    
+    // Hirschberg分治：矩形[r0, r1] x [c0, c1]的上边界行top与左边界列left为全局DP值，
+    // 从(r1, c1)沿reconstructPath的回溯路径走到(r0, c0)，逆序追加路径移动
+    static void hirschbergAlign(const std::string& str1, const std::string& str2,
+                                int r0, int r1, int c0, int c1,
+                                std::vector<int> top, std::vector<int> left,
+                                std::vector<char>& moves);
+    
+    // 带Ukkonen截断的分块位并行核心，距离超过k时返回k+1（要求pattern不长于text）
+    static int blockedBitParallelWithin(const std::string& pattern, const std::string& text, int k);
 };
 
 #endif // DYNAMIC_PROGRAMMING_H
\ No newline at end of file
@@ -0,0 +1,419 @@
+#include "edit_distance_engine.h"
+#include "char_histogram.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <stdexcept>
+
+using namespace std;
+
+namespace {
+
+typedef DynamicProgrammingEditDistance DP;
+
+// 不超过该长度的模式串由单字位并行一遍扫描完成，任何其他核心都不会更快
+const long long SINGLE_WORD_LENGTH = 64;
+
+// 去掉公共前后缀后剩下的部分（不修改编辑距离），first为a的剩余部分
+struct Core {
+    string first, second;
+};
+
+Core stripCommonAffixes(const string& a, const string& b) {
+    size_t limit = min(a.length(), b.length());
+    size_t prefix = 0;
+    while (prefix < limit && a[prefix] == b[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < limit - prefix && a[a.length() - 1 - suffix] == b[b.length() - 1 - suffix]) {
+        suffix++;
+    }
+    Core core;
+    core.first = a.substr(prefix, a.length() - prefix - suffix);
+    core.second = b.substr(prefix, b.length() - prefix - suffix);
+    return core;
+}
+
+long long wordsFor(long long length) {
+    return (length + 63) / 64;
+}
+
+// 带阈值k的位并行代价：只处理2k+1宽的对角带
+double bandedCost(const EditDistanceEngine::Profile& profile, long long m, long long n, long long k) {
+    return profile.bit_parallel_ns_per_word * n * wordsFor(min(m, 2 * k + 1));
+}
+
+// 分块位并行按倍增的阈值处理Ukkonen带（起始阈值至少为64），总代价约为最后一轮的两倍
+double bitParallelCost(const EditDistanceEngine::Profile& profile, long long m, long long n, long long d) {
+    return 2.0 * bandedCost(profile, m, n, max(d, 64LL));
+}
+
+// 对角线转移：每个错误数e处理2e+1条对角线，另加沿对角线延伸的字符比较
+double diagonalCost(const EditDistanceEngine::Profile& profile, long long n, long long d) {
+    return profile.diagonal_ns_per_step * (double)(d + 1) * (d + 1) + profile.diagonal_ns_per_char * n;
+}
+
+// 对角线转移先行、超过cap再改用fallback_k阈值（为负表示不设阈值）的位并行，
+// 返回满足"对角线转移代价不超过改用位并行的代价"的最大错误数，不值得先行时返回-1
+long long diagonalCap(const EditDistanceEngine::Profile& profile, long long m, long long n,
+                      long long lower_bound, long long fallback_k) {
+    auto worthwhile = [&](long long d) {
+        double fallback = fallback_k >= 0 ? bandedCost(profile, m, n, fallback_k)
+                                          : bitParallelCost(profile, m, n, d);
+        return diagonalCost(profile, n, d) <= fallback;
+    };
+    long long limit = fallback_k >= 0 ? fallback_k : m + n;
+    if (lower_bound > limit || !worthwhile(lower_bound)) {
+        return -1;
+    }
+    
+    // 对角线转移的代价随d平方增长，位并行线性增长：倍增找到不划算的点后二分
+    long long good = lower_bound;
+    long long bad = -1;
+    for (long long d = max(1LL, 2 * lower_bound); ; d *= 2) {
+        if (d >= limit) {
+            if (worthwhile(limit)) return limit;
+            bad = limit;
+            break;
+        }
+        if (!worthwhile(d)) {
+            bad = d;
+            break;
+        }
+        good = d;
+    }
+    while (bad - good > 1) {
+        long long mid = good + (bad - good) / 2;
+        if (worthwhile(mid)) {
+            good = mid;
+        } else {
+            bad = mid;
+        }
+    }
+    return good;
+}
+
+// 选择结果：核心、对角线转移的错误数上限，以及去掉公共前后缀后可直接得出的距离
+struct Plan {
+    EditDistanceEngine::Kernel kernel;
+    long long diagonal_cap;
+    int trivial_distance;
+};
+
+bool unitCosts(const EditDistanceEngine::Options& options) {
+    return options.insert_cost == 1 && options.delete_cost == 1 && options.replace_cost == 1;
+}
+
+Plan choose(const EditDistanceEngine::Profile& profile, const Core& core,
+            const EditDistanceEngine::Options& options, long long full_cells) {
+    Plan plan;
+    plan.kernel = EditDistanceEngine::KERNEL_TRIVIAL;
+    plan.diagonal_cap = -1;
+    plan.trivial_distance = 0;
+    
+    if (options.output == EditDistanceEngine::OPERATIONS) {
+        // 回溯矩阵比Hirschberg少一半的DP计算，只受内存限制
+        plan.kernel = full_cells <= profile.traceback_cell_limit ? EditDistanceEngine::KERNEL_TRACEBACK
+                                                                 : EditDistanceEngine::KERNEL_HIRSCHBERG;
+        return plan;
+    }
+    
+    long long m = core.first.length();
+    long long n = core.second.length();
+    
+    if (!unitCosts(options)) {
+        if (m == 0 || n == 0) {
+            plan.trivial_distance = (int)(n * options.insert_cost + m * options.delete_cost);
+            return plan;
+        }
+        double cells = (double)m * n;
+        double scalar = profile.scalar_ns_per_cell * cells;
+        double simd = profile.simd_ns_per_cell * cells + profile.simd_fixed_ns;
+        plan.kernel = simd < scalar ? EditDistanceEngine::KERNEL_SIMD : EditDistanceEngine::KERNEL_WEIGHTED;
+        return plan;
+    }
+    
+    if (m > n) swap(m, n);
+    bool bounded = options.output == EditDistanceEngine::BOUNDED_DISTANCE && options.max_distance >= 0;
+    long long k = bounded ? options.max_distance : -1;
+    
+    if (m == 0 || (bounded && n - m > k)) {
+        plan.trivial_distance = (int)(bounded ? min(n, k + 1) : n);
+        return plan;
+    }
+    
+    if (m <= SINGLE_WORD_LENGTH) {
+        plan.kernel = bounded ? EditDistanceEngine::KERNEL_BANDED : EditDistanceEngine::KERNEL_BIT_PARALLEL;
+        return plan;
+    }
+    
+    // 字符直方图给出与字符集相关的下界，大字符集上的随机串下界接近真实距离
+    long long lower_bound = max(n - m, (long long)CharHistogram::bagDistance(
+        CharHistogram(core.first), CharHistogram(core.second)));
+    if (bounded && lower_bound > k) {
+        plan.trivial_distance = (int)(k + 1);
+        return plan;
+    }
+    
+    plan.diagonal_cap = diagonalCap(profile, m, n, lower_bound, k);
+    if (plan.diagonal_cap >= 0) {
+        plan.kernel = EditDistanceEngine::KERNEL_DIAGONAL_TRANSITION;
+    } else {
+        plan.kernel = bounded ? EditDistanceEngine::KERNEL_BANDED : EditDistanceEngine::KERNEL_BIT_PARALLEL;
+    }
+    return plan;
+}
+
+// 多次运行取最短时间(ns)
+template <typename Function>
+double bestTime(Function function, int repeats) {
+    double best = 0.0;
+    for (int r = 0; r < repeats; r++) {
+        auto start = chrono::high_resolution_clock::now();
+        function();
+        double elapsed = chrono::duration<double, nano>(chrono::high_resolution_clock::now() - start).count();
+        if (r == 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+string randomString(mt19937& rng, int length) {
+    string str(length, 'a');
+    for (int i = 0; i < length; i++) {
+        str[i] = (char)('a' + rng() % 26);
+    }
+    return str;
+}
+
+// 随机位置做num_edits次替换
+string mutate(mt19937& rng, string str, int num_edits) {
+    for (int e = 0; e < num_edits; e++) {
+        size_t pos = rng() % str.length();
+        str[pos] = str[pos] == 'z' ? 'a' : (char)(str[pos] + 1);
+    }
+    return str;
+}
+
+} // namespace
+
+const char* const EditDistanceEngine::DEFAULT_PROFILE_PATH = "edit_distance_profile.txt";
+
+EditDistanceEngine::Profile EditDistanceEngine::active_profile;
+
+EditDistanceEngine::Profile::Profile()
+    : bit_parallel_ns_per_word(5.0),
+      diagonal_ns_per_step(6.0),
+      diagonal_ns_per_char(8.0),
+      scalar_ns_per_cell(3.0),
+      simd_ns_per_cell(0.3),
+      simd_fixed_ns(800.0),
+      traceback_cell_limit(DynamicProgrammingEditDistance::TRACEBACK_CELL_LIMIT) {}
+
+EditDistanceEngine::Kernel EditDistanceEngine::selectKernel(const string& a, const string& b,
+                                                            const Options& options) {
+    long long full_cells = (long long)(a.length() + 1) * (b.length() + 1);
+    return choose(active_profile, stripCommonAffixes(a, b), options, full_cells).kernel;
+}
+
+EditDistanceEngine::EngineResult EditDistanceEngine::compute(const string& a, const string& b,
+                                                             const Options& options) {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    if (options.output == OPERATIONS && !unitCosts(options)) {
+        throw invalid_argument("EditDistanceEngine: operations are only available for unit costs");
+    }
+    
+    EngineResult result;
+    long long full_cells = (long long)(a.length() + 1) * (b.length() + 1);
+    Core core = stripCommonAffixes(a, b);
+    Plan plan = choose(active_profile, core, options, full_cells);
+    result.kernel = plan.kernel;
+    
+    bool bounded = options.output == BOUNDED_DISTANCE && options.max_distance >= 0;
+    int k = options.max_distance;
+    const string& s1 = core.first;
+    const string& s2 = core.second;
+    
+    switch (plan.kernel) {
+        case KERNEL_TRIVIAL:
+            result.distance = plan.trivial_distance;
+            break;
+        case KERNEL_BIT_PARALLEL:
+            result.distance = DP::bitParallelEditDistance(s1, s2);
+            break;
+        case KERNEL_BANDED:
+            result.distance = DP::bitParallelBoundedEditDistance(s1, s2, k);
+            break;
+        case KERNEL_DIAGONAL_TRANSITION:
+            result.distance = DP::diagonalTransitionBoundedEditDistance(s1, s2, (int)plan.diagonal_cap);
+            if (result.distance > plan.diagonal_cap && !(bounded && plan.diagonal_cap == k)) {
+                // 差异超出代价模型的预期，改用位并行
+                if (bounded) {
+                    result.kernel = KERNEL_BANDED;
+                    result.distance = DP::bitParallelBoundedEditDistance(s1, s2, k);
+                } else {
+                    result.kernel = KERNEL_BIT_PARALLEL;
+                    result.distance = DP::bitParallelEditDistance(s1, s2);
+                }
+            }
+            break;
+        case KERNEL_SIMD:
+            result.distance = DP::simdEditDistance(s1, s2, options.insert_cost,
+                                                   options.delete_cost, options.replace_cost);
+            break;
+        case KERNEL_WEIGHTED:
+            result.distance = DP::weightedEditDistance(s1, s2, options.insert_cost,
+                                                       options.delete_cost, options.replace_cost);
+            break;
+        case KERNEL_TRACEBACK:
+        case KERNEL_HIRSCHBERG: {
+            auto full = plan.kernel == KERNEL_TRACEBACK ? DP::tracebackEditDistance(a, b)
+                                                        : DP::hirschbergEditDistance(a, b);
+            result.distance = full.distance;
+            result.operations.swap(full.operations);
+            break;
+        }
+    }
+    
+    if (bounded && result.distance > k) {
+        result.distance = k + 1;
+    }
+    result.within_bound = options.max_distance < 0 || result.distance <= options.max_distance;
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;
+    
+    return result;
+}
+
+EditDistanceEngine::Profile EditDistanceEngine::calibrate() {
+    Profile profile;
+    mt19937 rng(20240601);
+    volatile int sink = 0;
+    const int REPEATS = 3;
+    
+    // 几乎相同的串只有沿对角线延伸的开销；差异较大时对角线转移由错误数主导，
+    // 同一对串上的分块位并行给出每个字的代价（与模型一样按最后一轮带宽的两倍计）
+    {
+        string base = randomString(rng, 50000);
+        string near = mutate(rng, base, 1);
+        double extend_ns = bestTime([&]() {
+            sink = sink + DP::diagonalTransitionBoundedEditDistance(base, near, -1);
+        }, REPEATS);
+        profile.diagonal_ns_per_char = extend_ns / base.length();
+        
+        string far = mutate(rng, base, 1000);
+        long long d = DP::diagonalTransitionBoundedEditDistance(base, far, -1);
+        double diagonal_ns = bestTime([&]() {
+            sink = sink + DP::diagonalTransitionBoundedEditDistance(base, far, -1);
+        }, REPEATS);
+        profile.diagonal_ns_per_step = max(diagonal_ns - extend_ns, 1.0) / ((double)(d + 1) * (d + 1));
+        
+        double bit_parallel_ns = bestTime([&]() { sink = sink + DP::bitParallelEditDistance(base, far); },
+                                          REPEATS);
+        long long n = base.length();
+        profile.bit_parallel_ns_per_word = bit_parallel_ns / (2.0 * n * wordsFor(min(n, 2 * max(d, 64LL) + 1)));
+    }
+    
+    // 加权DP：标量与SIMD的单元格代价，SIMD的固定开销在小输入上测量
+    {
+        string str1 = randomString(rng, 400);
+        string str2 = randomString(rng, 400);
+        double cells = (double)str1.length() * str2.length();
+        double scalar_ns = bestTime([&]() { sink = sink + DP::weightedEditDistance(str1, str2, 1, 1, 2); },
+                                    REPEATS);
+        double simd_ns = bestTime([&]() { sink = sink + DP::simdEditDistance(str1, str2, 1, 1, 2); }, REPEATS);
+        profile.scalar_ns_per_cell = scalar_ns / cells;
+        profile.simd_ns_per_cell = simd_ns / cells;
+    
+        const int SMALL_RUNS = 1000;
+        string small1 = str1.substr(0, 8);
+        string small2 = str2.substr(0, 8);
+        double small_ns = bestTime([&]() {
+            for (int r = 0; r < SMALL_RUNS; r++) {
+                sink = sink + DP::simdEditDistance(small1, small2, 1, 1, 2);
+            }
+        }, REPEATS) / SMALL_RUNS;
+        profile.simd_fixed_ns = max(small_ns - profile.simd_ns_per_cell * 64, 0.0);
+    }
+    
+    return profile;
+}
+
+bool EditDistanceEngine::loadProfile(const string& path) {
+    ifstream in(path.c_str());
+    if (!in) return false;
+    
+    Profile profile;
+    string line;
+    while (getline(in, line)) {
+        istringstream fields(line);
+        string key;
+        if (!(fields >> key) || key[0] == '#') continue;
+    
+        double value;
+        if (!(fields >> value) || value < 0) return false;
+    
+        if (key == "bit_parallel_ns_per_word") profile.bit_parallel_ns_per_word = value;
+        else if (key == "diagonal_ns_per_step") profile.diagonal_ns_per_step = value;
+        else if (key == "diagonal_ns_per_char") profile.diagonal_ns_per_char = value;
+        else if (key == "scalar_ns_per_cell") profile.scalar_ns_per_cell = value;
+        else if (key == "simd_ns_per_cell") profile.simd_ns_per_cell = value;
+        else if (key == "simd_fixed_ns") profile.simd_fixed_ns = value;
+        else if (key == "traceback_cell_limit") profile.traceback_cell_limit = (long long)value;
+        // 未知的项忽略，便于新旧版本共用配置文件
+    }
+    
+    active_profile = profile;
+    return true;
+}
+
+bool EditDistanceEngine::saveProfile(const Profile& profile, const string& path) {
+    ofstream out(path.c_str());
+    if (!out) return false;
+    
+    out << "# EditDistanceEngine cost model (ns), generated by EditDistanceEngine::calibrate()\n";
+    out << "bit_parallel_ns_per_word " << profile.bit_parallel_ns_per_word << "\n";
+    out << "diagonal_ns_per_step " << profile.diagonal_ns_per_step << "\n";
+    out << "diagonal_ns_per_char " << profile.diagonal_ns_per_char << "\n";
+    out << "scalar_ns_per_cell " << profile.scalar_ns_per_cell << "\n";
+    out << "simd_ns_per_cell " << profile.simd_ns_per_cell << "\n";
+    out << "simd_fixed_ns " << profile.simd_fixed_ns << "\n";
+    out << "traceback_cell_limit " << profile.traceback_cell_limit << "\n";
+    return (bool)out;
+}
+
+bool EditDistanceEngine::loadOrCalibrate(const string& path) {
+    if (loadProfile(path)) return true;
+    
+    Profile profile = calibrate();
+    setProfile(profile);
+    saveProfile(profile, path);
+    return false;
+}
+
+void EditDistanceEngine::setProfile(const Profile& profile) {
+    active_profile = profile;
+}
+
+const EditDistanceEngine::Profile& EditDistanceEngine::currentProfile() {
+    return active_profile;
+}
+
+const char* EditDistanceEngine::kernelName(Kernel kernel) {
+    switch (kernel) {
+        case KERNEL_TRIVIAL: return "trivial";
+        case KERNEL_BIT_PARALLEL: return "bit-parallel";
+        case KERNEL_BANDED: return "banded";
+        case KERNEL_DIAGONAL_TRANSITION: return "diagonal-transition";
+        case KERNEL_SIMD: return "simd";
+        case KERNEL_WEIGHTED: return "weighted";
+        case KERNEL_TRACEBACK: return "traceback";
+        case KERNEL_HIRSCHBERG: return "hirschberg";
+    }
+    return "unknown";
+}
@@ -0,0 +1,117 @@
+#ifndef EDIT_DISTANCE_ENGINE_H
+#define EDIT_DISTANCE_ENGINE_H
+
+#include <string>
+#include <vector>
+#include "dynamic_programming.h"
+
+/**
+ * 编辑距离统一入口 - 根据长度、字符集、阈值和所需输出，用代价模型选出最快的精确算法：
+ * 位并行、带状（带阈值位并行）、SIMD反对角线、对角线转移、回溯矩阵与Hirschberg。
+ * 模型中的常数来自一次校准运行，保存在本地的小型配置文件中
+ */
+class EditDistanceEngine {
+public:
+    // 所需输出
+    enum OutputKind {
+        DISTANCE_ONLY = 0,      // 只需要距离
+        BOUNDED_DISTANCE = 1,   // 只需判断是否不超过max_distance
+        OPERATIONS = 2          // 需要操作序列
+    };
+    
+    // 可选的计算核心
+    enum Kernel {
+        KERNEL_TRIVIAL = 0,             // 去掉公共前后缀后可直接得出，或被长度差排除
+        KERNEL_BIT_PARALLEL = 1,        // bitParallelEditDistance
+        KERNEL_BANDED = 2,              // bitParallelBoundedEditDistance
+        KERNEL_DIAGONAL_TRANSITION = 3, // diagonalTransitionBoundedEditDistance
+        KERNEL_SIMD = 4,                // simdEditDistance（非单位代价）
+        KERNEL_WEIGHTED = 5,            // weightedEditDistance（非单位代价的小规模输入）
+        KERNEL_TRACEBACK = 6,           // tracebackEditDistance
+        KERNEL_HIRSCHBERG = 7           // hirschbergEditDistance
+    };
+    
+    // 计算选项
+    struct Options {
+        OutputKind output;
+        int max_distance;       // BOUNDED_DISTANCE时的阈值
+        int insert_cost;
+        int delete_cost;
+        int replace_cost;
+    
+        Options(OutputKind kind = DISTANCE_ONLY, int k = -1)
+            : output(kind), max_distance(k), insert_cost(1), delete_cost(1), replace_cost(1) {}
+    };
+    
+    // 计算结果
+    struct EngineResult {
+        int distance;           // 编辑距离；BOUNDED_DISTANCE且超过阈值时为max_distance+1
+        bool within_bound;      // 距离不超过max_distance（未设阈值时恒为true）
+        Kernel kernel;          // 实际使用的核心
+        std::vector<DynamicProgrammingEditDistance::EditOperation> operations; // OPERATIONS时的操作序列
+        double computation_time; // 计算时间(ms)
+    };
+    
+    // 代价模型常数（纳秒），由calibrate()测得
+    struct Profile {
+        double bit_parallel_ns_per_word;    // 位并行每处理一列中的一个64位字
+        double diagonal_ns_per_step;        // 对角线转移每个(错误数, 对角线)步骤
+        double diagonal_ns_per_char;        // 对角线转移沿对角线延伸每个字符
+        double scalar_ns_per_cell;          // 标量加权DP每个单元格
+        double simd_ns_per_cell;            // SIMD反对角线DP每个单元格
+        double simd_fixed_ns;               // SIMD反对角线DP的固定开销
+        long long traceback_cell_limit;     // 回溯矩阵的单元格上限，超过时使用Hirschberg
+    
+        // 未校准时的默认值
+        Profile();
+    };
+
+public:
+    /**
+     * 计算a、b的编辑距离，由代价模型选择算法
+     * 非单位代价不支持OPERATIONS，抛出std::invalid_argument
+     */
+    static EngineResult compute(const std::string& a, const std::string& b,
+                                const Options& options = Options());
+    
+    /**
+     * 只做选择不做计算，返回compute首先使用的核心
+     * （对角线转移的错误数超出模型预期时，compute会改用位并行，结果中的kernel随之改变）
+     */
+    static Kernel selectKernel(const std::string& a, const std::string& b,
+                               const Options& options = Options());
+    
+    /**
+     * 在随机字符串上测量各核心的速度，返回新的代价模型（不修改当前模型）
+     */
+    static Profile calibrate();
+    
+    /**
+     * 读取配置文件并设为当前模型；文件不存在或格式错误时返回false，当前模型不变
+     * 格式为每行"名称 数值"，#开头的行为注释，缺少的项保持默认值
+     */
+    static bool loadProfile(const std::string& path = DEFAULT_PROFILE_PATH);
+    
+    /**
+     * 保存代价模型到配置文件
+     */
+    static bool saveProfile(const Profile& profile, const std::string& path = DEFAULT_PROFILE_PATH);
+    
+    /**
+     * 读取配置文件；不存在时校准并保存。返回true表示使用了已有的配置
+     */
+    static bool loadOrCalibrate(const std::string& path = DEFAULT_PROFILE_PATH);
+    
+    static void setProfile(const Profile& profile);
+    static const Profile& currentProfile();
+    
+    // 辅助函数：核心名称
+    static const char* kernelName(Kernel kernel);
+    
+    static const char* const DEFAULT_PROFILE_PATH;
+
+private:
+    static Profile active_profile;
+};
+
+#endif // EDIT_DISTANCE_ENGINE_H
@@ -0,0 +1,131 @@
+#include "edit_script.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+typedef DynamicProgrammingEditDistance DP;
+typedef GreedyEditDistance Greedy;
+
+string EditScript::apply(const string& source, const vector<DP::EditOperation>& operations) {
+    string result;
+    result.reserve(source.length() + operations.size());
+    
+    int cursor = 0;  // 下一个尚未输出的源字符
+    for (const auto& op : operations) {
+        // 操作之前未被覆盖的源字符原样保留
+        int pos = min(max(op.pos1, cursor), (int)source.length());
+        result.append(source, cursor, pos - cursor);
+        cursor = pos;
+        
+        switch (op.op) {
+            case DP::MATCH:
+                if (cursor < (int)source.length()) {
+                    result += source[cursor++];
+                }
+                break;
+            case DP::REPLACE:
+                result += op.to_char;
+                cursor = min(cursor + 1, (int)source.length());
+                break;
+            case DP::DELETE:
+                cursor = min(cursor + 1, (int)source.length());
+                break;
+            case DP::INSERT:
+                result += op.to_char;
+                break;
+        }
+    }
+    result.append(source, cursor, string::npos);
+    
+    return result;
+}
+
+string EditScript::apply(const string& source, const vector<Greedy::EditOperation>& operations) {
+    GapBuffer buffer(source);
+    
+    for (const auto& op : operations) {
+        switch (op.type) {
+            case Greedy::INSERT:
+                buffer.insert(op.position, op.to_char);
+                break;
+            case Greedy::DELETE:
+                buffer.erase(op.position);
+                break;
+            case Greedy::REPLACE:
+                buffer.replace(op.position, op.to_char);
+                break;
+            case Greedy::MATCH:
+                break;
+        }
+    }
+    
+    return buffer.toString();
+}
+
+EditScript::GapBuffer::GapBuffer(const string& text)
+    : buffer(text.begin(), text.end()), gap_begin(text.length()), gap_end(text.length()) {
+    grow();
+}
+
+void EditScript::GapBuffer::insert(int pos, char c) {
+    pos = min(max(pos, 0), length());
+    moveGap(pos);
+    if (gap_begin == gap_end) {
+        grow();
+    }
+    buffer[gap_begin++] = c;
+}
+
+void EditScript::GapBuffer::erase(int pos) {
+    if (pos < 0 || pos >= length()) return;
+    moveGap(pos);
+    gap_end++;
+}
+
+void EditScript::GapBuffer::replace(int pos, char c) {
+    if (pos < 0 || pos >= length()) return;
+    if (pos < gap_begin) {
+        buffer[pos] = c;
+    } else {
+        buffer[gap_end + (pos - gap_begin)] = c;
+    }
+}
+
+int EditScript::GapBuffer::length() const {
+    return buffer.size() - (gap_end - gap_begin);
+}
+
+string EditScript::GapBuffer::toString() const {
+    string text;
+    text.reserve(length());
+    text.append(buffer.begin(), buffer.begin() + gap_begin);
+    text.append(buffer.begin() + gap_end, buffer.end());
+    return text;
+}
+
+void EditScript::GapBuffer::moveGap(int pos) {
+    if (pos < gap_begin) {
+        // 间隙左移：[pos, gap_begin)搬到间隙右侧
+        int count = gap_begin - pos;
+        memmove(&buffer[gap_end - count], &buffer[pos], count);
+        gap_begin -= count;
+        gap_end -= count;
+    } else if (pos > gap_begin) {
+        int count = pos - gap_begin;
+        memmove(&buffer[gap_begin], &buffer[gap_end], count);
+        gap_begin += count;
+        gap_end += count;
+    }
+}
+
+void EditScript::GapBuffer::grow() {
+    // 间隙容量翻倍，保证连续插入的均摊代价为O(1)
+    int tail = buffer.size() - gap_end;
+    int extra = max((int)buffer.size(), 16);
+    buffer.resize(buffer.size() + extra);
+    if (tail > 0) {
+        memmove(&buffer[buffer.size() - tail], &buffer[gap_end], tail);
+    }
+    gap_end = buffer.size() - tail;
+}
@@ -0,0 +1,52 @@
+#ifndef EDIT_SCRIPT_H
+#define EDIT_SCRIPT_H
+
+#include <string>
+#include <vector>
+#include "dynamic_programming.h"
+#include "greedy_edit_distance.h"
+
+/**
+ * 编辑脚本应用引擎 - 把DP或贪心算法得到的操作序列整体作用到源字符串上
+ */
+class EditScript {
+public:
+    /**
+     * 应用DP操作序列：pos1为源串下标，操作按pos1升序排列（reconstructPath的输出）
+     * 未被操作覆盖的源字符原样保留，一次线性遍历完成
+     * 时间复杂度: O(m+操作数)
+     */
+    static std::string apply(const std::string& source,
+                             const std::vector<DynamicProgrammingEditDistance::EditOperation>& operations);
+    
+    /**
+     * 应用贪心操作序列：position为执行该操作时工作串中的下标，按顺序依次执行
+     * 使用间隙缓冲区，相邻操作的位置接近时每次操作为O(1)
+     * 时间复杂度: O(m+操作数+间隙移动总距离)
+     */
+    static std::string apply(const std::string& source,
+                             const std::vector<GreedyEditDistance::EditOperation>& operations);
+
+private:
+    // 间隙缓冲区：[0, gap_begin)和[gap_end, size)存放文本，中间为空闲间隙
+    class GapBuffer {
+    public:
+        explicit GapBuffer(const std::string& text);
+        
+        void insert(int pos, char c);
+        void erase(int pos);
+        void replace(int pos, char c);
+        int length() const;
+        std::string toString() const;
+        
+    private:
+        std::vector<char> buffer;
+        int gap_begin, gap_end;
+        
+        // 把间隙移动到pos处
+        void moveGap(int pos);
+        void grow();
+    };
+};
+
+#endif // EDIT_SCRIPT_H
@@ -0,0 +1,157 @@
+#include "filter_cascade.h"
+#include "dynamic_programming.h"
+#include "greedy_edit_distance.h"
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+
+FilterCascade::FilterCascade(int gram_length) : q(max(1, min(gram_length, 8))) {}
+
+FilterCascade::Result FilterCascade::filter(
+    const string& target, const vector<string>& candidates, int k) const {
+    return run(target, candidates, nullptr, k);
+}
+
+FilterCascade::Result FilterCascade::filter(
+    const string& target, const vector<string>& candidates,
+    const vector<CharHistogram>& signatures, int k) const {
+    return run(target, candidates, &signatures, k);
+}
+
+FilterCascade::Result FilterCascade::run(
+    const string& target, const vector<string>& candidates,
+    const vector<CharHistogram>* signatures, int k) const {
+    
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    Result result;
+    Stats& stats = result.stats;
+    stats.candidates = candidates.size();
+    stats.length_eliminated = 0;
+    stats.bag_eliminated = 0;
+    stats.qgram_eliminated = 0;
+    stats.banded_eliminated = 0;
+    stats.resolved_by_bounds = 0;
+    stats.verified = 0;
+    
+    int n = target.length();
+    CharHistogram target_hist(target);
+    CharHistogram candidate_hist;
+    vector<uint64_t> target_grams = sortedGrams(target, q);
+    
+    for (size_t index = 0; index < candidates.size(); index++) {
+        const string& candidate = candidates[index];
+        int m = candidate.length();
+        
+        // 1. 长度差
+        int lower = abs(m - n);
+        if (k < 0 || lower > k) {
+            stats.length_eliminated++;
+            continue;
+        }
+        
+        // 2. 字符直方图距离
+        const CharHistogram* hist = &candidate_hist;
+        if (signatures != nullptr) {
+            hist = &(*signatures)[index];
+        } else {
+            candidate_hist.assign(candidate);
+        }
+        int bag = CharHistogram::bagDistance(*hist, target_hist);
+        if (bag > k) {
+            stats.bag_eliminated++;
+            continue;
+        }
+        lower = max(lower, bag);
+        
+        // 3. q-gram计数下界，只在引理能给出正的阈值时计算
+        if (max(m, n) - q + 1 - k * q > 0) {
+            int shared = sharedGrams(target_grams, sortedGrams(candidate, q));
+            int qgram = qgramLowerBound(m, n, shared, q);
+            if (qgram > k) {
+                stats.qgram_eliminated++;
+                continue;
+            }
+            lower = max(lower, qgram);
+        }
+        
+        // 4. 贪心上界：与下界相等时即为精确值，否则以上界收紧带宽
+        int upper = GreedyEditDistance::heuristicUpperBound(candidate, target);
+        if (upper <= lower) {
+            stats.resolved_by_bounds++;
+            result.matches.emplace_back(index, upper);
+            continue;
+        }
+        
+        int bound = min(k, upper);
+        stats.verified++;
+        int distance = DynamicProgrammingEditDistance::boundedEditDistance(candidate, target, bound);
+        if (distance > k) {
+            stats.banded_eliminated++;
+            continue;
+        }
+        result.matches.emplace_back(index, distance);
+    }
+    
+    sort(result.matches.begin(), result.matches.end(),
+         [](const pair<int, int>& a, const pair<int, int>& b) {
+             return a.second != b.second ? a.second < b.second : a.first < b.first;
+         });
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    stats.computation_time = chrono::duration<double, milli>(end_time - start_time).count();
+    
+    return result;
+}
+
+int FilterCascade::bagDistance(const string& str1, const string& str2) {
+    return CharHistogram::bagDistance(CharHistogram(str1), CharHistogram(str2));
+}
+
+int FilterCascade::qgramLowerBound(const string& str1, const string& str2, int q) {
+    q = max(1, min(q, 8));
+    int shared = sharedGrams(sortedGrams(str1, q), sortedGrams(str2, q));
+    return qgramLowerBound(str1.length(), str2.length(), shared, q);
+}
+
+int FilterCascade::qgramLowerBound(int m, int n, int shared, int q) {
+    int missing = max(m, n) - q + 1 - shared;
+    if (missing <= 0) return 0;
+    return (missing + q - 1) / q;
+}
+
+vector<uint64_t> FilterCascade::sortedGrams(const string& str, int q) {
+    vector<uint64_t> grams;
+    if ((int)str.length() >= q) {
+        grams.reserve(str.length() - q + 1);
+    }
+    uint64_t mask = q == 8 ? ~0ULL : (1ULL << (8 * q)) - 1;
+    uint64_t gram = 0;
+    for (size_t i = 0; i < str.length(); i++) {
+        gram = ((gram << 8) | (unsigned char)str[i]) & mask;
+        if ((int)i + 1 >= q) {
+            grams.push_back(gram);
+        }
+    }
+    sort(grams.begin(), grams.end());
+    return grams;
+}
+
+int FilterCascade::sharedGrams(const vector<uint64_t>& a, const vector<uint64_t>& b) {
+    int shared = 0;
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size()) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            shared++;
+            i++;
+            j++;
+        }
+    }
+    return shared;
+}
@@ -0,0 +1,80 @@
+#ifndef FILTER_CASCADE_H
+#define FILTER_CASCADE_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "char_histogram.h"
+
+/**
+ * 可证明下界的过滤级联 - 在精确验证之前依次用越来越贵的下界淘汰候选：
+ * 长度差 -> 字符直方图（bag）距离 -> q-gram计数下界 -> 带状DP。
+ * 贪心启发式给出的距离是可靠的上界，上下界相等时无需DP，否则用上界收紧DP的带宽
+ */
+class FilterCascade {
+public:
+    // 各级过滤的统计
+    struct Stats {
+        int candidates;             // 候选总数
+        int length_eliminated;      // 被长度差淘汰
+        int bag_eliminated;         // 被直方图距离淘汰
+        int qgram_eliminated;       // 被q-gram下界淘汰
+        int banded_eliminated;      // 带状DP确认超过阈值
+        int resolved_by_bounds;     // 上下界相等，无需DP
+        int verified;               // 运行带状DP的候选数
+        double computation_time;    // 计算时间(ms)
+    };
+    
+    // 阈值查询结果
+    struct Result {
+        std::vector<std::pair<int, int>> matches; // (候选下标, 距离)，按距离排序
+        Stats stats;
+    };
+
+public:
+    /**
+     * q为q-gram下界使用的gram长度，取值范围为[1, 8]
+     */
+    explicit FilterCascade(int q = 2);
+    
+    /**
+     * 阈值查询 - 返回与target编辑距离不超过k的候选
+     */
+    Result filter(const std::string& target, const std::vector<std::string>& candidates, int k) const;
+    
+    /**
+     * 阈值查询 - 使用候选的预计算直方图签名（与candidates一一对应，见CharHistogram::build）
+     */
+    Result filter(const std::string& target, const std::vector<std::string>& candidates,
+                  const std::vector<CharHistogram>& signatures, int k) const;
+    
+    /**
+     * 字符直方图距离：max(多出的字符数, 缺少的字符数)，是编辑距离的下界
+     * 时间复杂度: O(m+n)，两个直方图已知时见CharHistogram::bagDistance
+     */
+    static int bagDistance(const std::string& str1, const std::string& str2);
+    
+    /**
+     * q-gram下界：每次编辑至多破坏q个q-gram，
+     * 距离 >= ceil((max(m,n) - q + 1 - 共享q-gram数) / q)
+     */
+    static int qgramLowerBound(const std::string& str1, const std::string& str2, int q);
+
+private:
+    int q;
+    
+    // signatures为空时逐个统计候选的直方图
+    Result run(const std::string& target, const std::vector<std::string>& candidates,
+               const std::vector<CharHistogram>* signatures, int k) const;
+    
+    // 字符串中所有q-gram打包后排序
+    static std::vector<uint64_t> sortedGrams(const std::string& str, int q);
+    
+    // 两个有序q-gram序列的多重集交集大小
+    static int sharedGrams(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+    
+    static int qgramLowerBound(int m, int n, int shared, int q);
+};
+
+#endif // FILTER_CASCADE_H
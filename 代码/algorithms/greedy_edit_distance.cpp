@@ -1,7 +1,10 @@
 #include "greedy_edit_distance.h"
+#include "edit_script.h"
 #include <algorithm>
 #include <chrono>
-#include <unordered_set>
+#include <bitset>
+#include <cstdint>
+#include <climits>
 
 using namespace std;
 
@@ -12,41 +15,43 @@ GreedyEditDistance::GreedyResult GreedyEditDistance::basicGreedyEditDistance(
     
     GreedyResult result;
     result.distance = 0;
-    result.final_string = source;
     
-    string current = source;
+    // 只记录操作，不修改工作串；current[pos]对应source[pos + deleted]
+    int current_length = source.length();
+    int deleted = 0;
     int pos = 0;
     
     // 贪心策略：从左到右逐字符匹配
-    while (pos < max(current.length(), target.length())) {
-        if (pos >= current.length()) {
+    while (pos < max(current_length, (int)target.length())) {
+        if (pos >= current_length) {
             // 需要插入字符
             char insert_char = target[pos];
-            current.insert(pos, 1, insert_char);
             result.operations.push_back(EditOperation(INSERT, pos, '\0', insert_char));
             result.distance++;
+            current_length++;
         } else if (pos >= target.length()) {
             // 需要删除字符
-            char delete_char = current[pos];
-            current.erase(pos, 1);
+            char delete_char = source[pos + deleted];
             result.operations.push_back(EditOperation(DELETE, pos, delete_char, '\0'));
             result.distance++;
+            deleted++;
+            current_length--;
             continue; // 不增加pos，因为字符串变短了
-        } else if (current[pos] == target[pos]) {
+        } else if (source[pos + deleted] == target[pos]) {
             // 字符匹配，直接跳过
-            result.operations.push_back(EditOperation(MATCH, pos, current[pos], target[pos]));
+            result.operations.push_back(EditOperation(MATCH, pos, target[pos], target[pos]));
         } else {
             // 需要替换字符
-            char from_char = current[pos];
+            char from_char = source[pos + deleted];
             char to_char = target[pos];
-            current[pos] = to_char;
             result.operations.push_back(EditOperation(REPLACE, pos, from_char, to_char));
             result.distance++;
         }
         pos++;
     }
     
-    result.final_string = current;
+    // 一次线性遍历生成最终字符串
+    result.final_string = EditScript::apply(source, result.operations);
     
     auto end_time = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
@@ -67,48 +72,72 @@ GreedyEditDistance::GreedyResult GreedyEditDistance::frequencyBasedGreedy(
     auto source_freq = calculateFrequency(source);
     auto target_freq = calculateFrequency(target);
     
-    string current = source;
+    // 插入的字符依次追加在末尾；删除的字符是该字符在source中最靠前的几次出现，
+    // 删除时的位置等于原下标减去其前面已删除的字符数（树状数组统计）
+    int source_length = source.length();
+    vector<bool> removed(source_length, false);
+    vector<int> removed_tree(source_length + 1, 0);
     
     // 贪心策略：优先保留目标字符串中频率高的字符
-    for (auto& pair : target_freq) {
-        char target_char = pair.first;
-        int target_count = pair.second;
-        int source_count = (source_freq.find(target_char) != source_freq.end()) ? 
-                          source_freq[target_char] : 0;
+    // 按char的取值顺序遍历各字符（与按字符排序的有序表一致）
+    string inserted;
+    for (int value = CHAR_MIN; value <= CHAR_MAX; value++) {
+        char target_char = (char)value;
+        int target_count = target_freq[(unsigned char)target_char];
+        int source_count = source_freq[(unsigned char)target_char];
         
         if (source_count < target_count) {
             // 需要插入字符
             int insert_count = target_count - source_count;
             for (int i = 0; i < insert_count; i++) {
-                current += target_char;
-                result.operations.push_back(EditOperation(INSERT, current.length()-1, '\0', target_char));
+                inserted += target_char;
+                result.operations.push_back(EditOperation(INSERT, source_length + inserted.length() - 1, '\0', target_char));
                 result.distance++;
             }
         }
     }
     
-    // 删除不需要的字符
-    for (auto& pair : source_freq) {
-        char source_char = pair.first;
-        int source_count = pair.second;
-        int target_count = (target_freq.find(source_char) != target_freq.end()) ? 
-                          target_freq[source_char] : 0;
+    // 删除不需要的字符：各字符的出现位置按下标升序排列
+    vector<vector<int>> occurrences(256);
+    for (int i = 0; i < source_length; i++) {
+        occurrences[(unsigned char)source[i]].push_back(i);
+    }
+    
+    int removed_count = 0;
+    for (int value = CHAR_MIN; value <= CHAR_MAX; value++) {
+        char source_char = (char)value;
+        int source_count = source_freq[(unsigned char)source_char];
+        int target_count = target_freq[(unsigned char)source_char];
         
         if (source_count > target_count) {
             int delete_count = source_count - target_count;
+            const vector<int>& positions = occurrences[(unsigned char)source_char];
             for (int i = 0; i < delete_count; i++) {
-                // 找到第一个该字符并删除
-                auto pos = current.find(source_char);
-                if (pos != string::npos) {
-                    current.erase(pos, 1);
-                    result.operations.push_back(EditOperation(DELETE, pos, source_char, '\0'));
-                    result.distance++;
+                int original = positions[i];
+                int removed_before = 0;
+                for (int x = original; x > 0; x -= x & -x) {
+                    removed_before += removed_tree[x];
+                }
+                result.operations.push_back(EditOperation(DELETE, original - removed_before, source_char, '\0'));
+                result.distance++;
+                
+                removed[original] = true;
+                removed_count++;
+                for (int x = original + 1; x <= source_length; x += x & -x) {
+                    removed_tree[x]++;
                 }
             }
         }
     }
     
-    result.final_string = current;
+    // 保留的原字符按顺序排列，后接追加的字符
+    result.final_string.reserve(source_length - removed_count + inserted.length());
+    for (int i = 0; i < source_length; i++) {
+        if (!removed[i]) {
+            result.final_string += source[i];
+        }
+    }
+    result.final_string += inserted;
     
     auto end_time = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
@@ -125,46 +154,41 @@ GreedyEditDistance::GreedyResult GreedyEditDistance::positionBasedGreedy(
     GreedyResult result;
     result.distance = 0;
     
-    // 找到最长公共子序列的位置
-    auto lcs_positions = findLCS(source, target);
-    
-    string current = source;
-    int offset = 0; // 由于插入删除操作导致的位置偏移
+    int current_length = source.length();
+    int offset = 0; // 由于删除操作导致的位置偏移
     
     // 贪心策略：保持LCS不变，调整其他字符
     for (size_t i = 0; i < max(source.length(), target.length()); i++) {
         int current_pos = i + offset;
         
         if (i >= target.length()) {
-            // 删除多余字符
-            if (current_pos < current.length()) {
-                char delete_char = current[current_pos];
-                current.erase(current_pos, 1);
+            // 删除多余字符（此前只替换过更靠前的位置，current[current_pos]即source[i]）
+            if (current_pos < current_length) {
+                char delete_char = source[i];
                 result.operations.push_back(EditOperation(DELETE, current_pos, delete_char, '\0'));
                 result.distance++;
+                current_length--;
                 offset--;
             }
-        } else if (current_pos >= current.length()) {
-            // 插入缺失字符
+        } else if (current_pos >= current_length) {
+            // 插入缺失字符，插入后target[i + 1]正好对应current_pos + 1，偏移不变
             char insert_char = target[i];
-            current.insert(current_pos, 1, insert_char);
             result.operations.push_back(EditOperation(INSERT, current_pos, '\0', insert_char));
             result.distance++;
-            offset++;
-        } else if (current[current_pos] != target[i]) {
+            current_length++;
+        } else if (source[i] != target[i]) {
             // 替换不匹配字符
-            char from_char = current[current_pos];
+            char from_char = source[i];
             char to_char = target[i];
-            current[current_pos] = to_char;
             result.operations.push_back(EditOperation(REPLACE, current_pos, from_char, to_char));
             result.distance++;
         } else {
             // 字符匹配
-            result.operations.push_back(EditOperation(MATCH, current_pos, current[current_pos], target[i]));
+            result.operations.push_back(EditOperation(MATCH, current_pos, source[i], target[i]));
         }
     }
     
-    result.final_string = current;
+    result.final_string = EditScript::apply(source, result.operations);
     
     auto end_time = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::microseconds>(end_time - start_time);
@@ -243,66 +267,237 @@ int GreedyEditDistance::quickApproximation(const string& source, const string& t
     // 快速近似：长度差 + 不匹配字符数的估计
     int len_diff = abs((int)source.length() - (int)target.length());
     
-    unordered_set<char> source_chars(source.begin(), source.end());
-    unordered_set<char> target_chars(target.begin(), target.end());
+    // 用256位的出现位图代替集合，不需要分配内存
+    bitset<256> source_chars, target_chars;
+    for (char c : source) {
+        source_chars.set((unsigned char)c);
+    }
+    for (char c : target) {
+        target_chars.set((unsigned char)c);
+    }
     
-    int unique_in_source = 0;
-    int unique_in_target = 0;
+    int unique_in_source = (source_chars & ~target_chars).count();
+    int unique_in_target = (target_chars & ~source_chars).count();
     
-    for (char c : source_chars) {
-        if (target_chars.find(c) == target_chars.end()) {
-            unique_in_source++;
-        }
+    return len_diff + max(unique_in_source, unique_in_target);
+}
+
+int GreedyEditDistance::heuristicUpperBound(const string& source, const string& target) {
+    int m = source.length(), n = target.length();
+    
+    int prefix_len = 0;
+    while (prefix_len < min(m, n) && source[prefix_len] == target[prefix_len]) {
+        prefix_len++;
     }
     
-    for (char c : target_chars) {
-        if (source_chars.find(c) == source_chars.end()) {
-            unique_in_target++;
+    int suffix_len = 0;
+    while (suffix_len < min(m, n) - prefix_len &&
+           source[m - 1 - suffix_len] == target[n - 1 - suffix_len]) {
+        suffix_len++;
+    }
+    
+    // 中间部分逐位比较，多出的字符全部插入或删除
+    int middle_source = m - prefix_len - suffix_len;
+    int middle_target = n - prefix_len - suffix_len;
+    int common = min(middle_source, middle_target);
+    int distance = abs(middle_source - middle_target);
+    for (int i = 0; i < common; i++) {
+        if (source[prefix_len + i] != target[prefix_len + i]) {
+            distance++;
         }
     }
+    return distance;
+}
+
+Cigar GreedyEditDistance::basicGreedyCigar(const string& source, const string& target) {
+    Cigar cigar;
+    int m = source.length(), n = target.length();
+    int common = min(m, n);
+    for (int i = 0; i < common; i++) {
+        if (source[i] == target[i]) {
+            cigar.append(Cigar::MATCH);
+        } else {
+            cigar.append(Cigar::REPLACE);
+        }
+    }
+    if (m > n) {
+        cigar.append(Cigar::DELETE, m - n);
+    } else {
+        cigar.append(Cigar::INSERT, n - m);
+    }
+    return cigar;
+}
+
+Cigar GreedyEditDistance::heuristicGreedyCigar(const string& source, const string& target) {
+    int m = source.length(), n = target.length();
     
-    return len_diff + max(unique_in_source, unique_in_target);
+    int prefix_len = 0;
+    while (prefix_len < min(m, n) && source[prefix_len] == target[prefix_len]) {
+        prefix_len++;
+    }
+    int suffix_len = 0;
+    while (suffix_len < min(m, n) - prefix_len &&
+           source[m - 1 - suffix_len] == target[n - 1 - suffix_len]) {
+        suffix_len++;
+    }
+    
+    // 前缀匹配 + 中间部分的基础贪心 + 后缀匹配
+    Cigar cigar;
+    cigar.append(Cigar::MATCH, prefix_len);
+    Cigar middle = basicGreedyCigar(source.substr(prefix_len, m - prefix_len - suffix_len),
+                                    target.substr(prefix_len, n - prefix_len - suffix_len));
+    for (const auto& run : middle.getRuns()) {
+        cigar.append(run.op, run.length);
+    }
+    cigar.append(Cigar::MATCH, suffix_len);
+    return cigar;
 }
 
-map<char, int> GreedyEditDistance::calculateFrequency(const string& str) {
-    map<char, int> freq;
+Cigar GreedyEditDistance::frequencyBasedCigar(const string& source, const string& target) {
+    auto source_freq = calculateFrequency(source);
+    auto target_freq = calculateFrequency(target);
+    
+    // 每种字符删除最靠前的多余出现，其余保留；缺少的字符追加在末尾
+    array<int, 256> to_delete;
+    int appended = 0;
+    for (int c = 0; c < 256; c++) {
+        to_delete[c] = max(0, source_freq[c] - target_freq[c]);
+        appended += max(0, target_freq[c] - source_freq[c]);
+    }
+    
+    Cigar cigar;
+    for (char c : source) {
+        int& remaining = to_delete[(unsigned char)c];
+        if (remaining > 0) {
+            remaining--;
+            cigar.append(Cigar::DELETE);
+        } else {
+            cigar.append(Cigar::MATCH);
+        }
+    }
+    cigar.append(Cigar::INSERT, appended);
+    return cigar;
+}
+
+array<int, 256> GreedyEditDistance::calculateFrequency(const string& str) {
+    array<int, 256> freq;
+    freq.fill(0);
     for (char c : str) {
-        freq[c]++;
+        freq[(unsigned char)c]++;
     }
     return freq;
 }
 
 vector<pair<int, int>> GreedyEditDistance::findLCS(const string& str1, const string& str2) {
-    int m = str1.length(), n = str2.length();
-    vector<vector<int>> dp(m + 1, vector<int>(n + 1, 0));
-    
-    // 计算LCS长度
-    for (int i = 1; i <= m; i++) {
-        for (int j = 1; j <= n; j++) {
-            if (str1[i-1] == str2[j-1]) {
-                dp[i][j] = dp[i-1][j-1] + 1;
+    vector<pair<int, int>> positions;
+    hirschbergLCS(str1, str2, 0, str1.length(), 0, str2.length(), positions);
+    return positions;
+}
+
+int GreedyEditDistance::lcsLength(const string& str1, const string& str2) {
+    vector<int> row = lcsRow(str1, str2);
+    return row.back();
+}
+
+vector<int> GreedyEditDistance::lcsRow(const string& str1, const string& str2) {
+    int n = str2.length();
+    int words = (n + 63) / 64;
+    
+    // str2中每种字符的出现位图，只为出现过的字符分配
+    int char_id[256];
+    fill(char_id, char_id + 256, -1);
+    vector<vector<uint64_t>> match_masks;
+    for (int j = 0; j < n; j++) {
+        unsigned char c = str2[j];
+        if (char_id[c] < 0) {
+            char_id[c] = match_masks.size();
+            match_masks.push_back(vector<uint64_t>(words, 0));
+        }
+        match_masks[char_id[c]][j / 64] |= 1ULL << (j % 64);
+    }
+    
+    vector<uint64_t> v(words, ~0ULL);
+    for (char c : str1) {
+        int id = char_id[(unsigned char)c];
+        if (id < 0) continue;
+        
+        const vector<uint64_t>& m = match_masks[id];
+        uint64_t carry = 0;
+        for (int w = 0; w < words; w++) {
+            uint64_t u = v[w] & m[w];
+            uint64_t sum = v[w] + u;
+            uint64_t next_carry = sum < v[w];
+            sum += carry;
+            next_carry |= sum < carry;
+            v[w] = sum | (v[w] & ~m[w]);
+            carry = next_carry;
+        }
+    }
+    
+    // 前j位中0的个数即为LCS(str1, str2前j个字符)
+    vector<int> row(n + 1, 0);
+    for (int j = 0; j < n; j++) {
+        row[j + 1] = row[j] + ((v[j / 64] >> (j % 64)) & 1 ? 0 : 1);
+    }
+    return row;
+}
+
+void GreedyEditDistance::hirschbergLCS(const string& str1, const string& str2,
+                                       int r0, int r1, int c0, int c1,
+                                       vector<pair<int, int>>& positions) {
+    int m = r1 - r0, n = c1 - c0;
+    if (m == 0 || n == 0) return;
+    
+    // 小规模子问题：DP表回溯
+    if ((long long)m * n <= LCS_TABLE_CELL_LIMIT || m == 1) {
+        vector<vector<int>> dp(m + 1, vector<int>(n + 1, 0));
+        for (int i = 1; i <= m; i++) {
+            for (int j = 1; j <= n; j++) {
+                if (str1[r0 + i - 1] == str2[c0 + j - 1]) {
+                    dp[i][j] = dp[i-1][j-1] + 1;
+                } else {
+                    dp[i][j] = max(dp[i-1][j], dp[i][j-1]);
+                }
+            }
+        }
+        
+        vector<pair<int, int>> local;
+        int i = m, j = n;
+        while (i > 0 && j > 0) {
+            if (str1[r0 + i - 1] == str2[c0 + j - 1]) {
+                local.push_back(make_pair(r0 + i - 1, c0 + j - 1));
+                i--; j--;
+            } else if (dp[i-1][j] > dp[i][j-1]) {
+                i--;
             } else {
-                dp[i][j] = max(dp[i-1][j], dp[i][j-1]);
+                j--;
             }
         }
+        positions.insert(positions.end(), local.rbegin(), local.rend());
+        return;
     }
     
-    // 回溯找到LCS位置
-    vector<pair<int, int>> positions;
-    int i = m, j = n;
-    while (i > 0 && j > 0) {
-        if (str1[i-1] == str2[j-1]) {
-            positions.push_back(make_pair(i-1, j-1));
-            i--; j--;
-        } else if (dp[i-1][j] > dp[i][j-1]) {
-            i--;
-        } else {
-            j--;
+    // 上半部分的正向行与下半部分的反向行之和最大处即为最优分割列
+    int mid = r0 + m / 2;
+    string sub2 = str2.substr(c0, n);
+    vector<int> forward = lcsRow(str1.substr(r0, mid - r0), sub2);
+    
+    string lower(str1.begin() + mid, str1.begin() + r1);
+    reverse(lower.begin(), lower.end());
+    reverse(sub2.begin(), sub2.end());
+    vector<int> backward = lcsRow(lower, sub2);
+    
+    int split = 0, best = -1;
+    for (int j = 0; j <= n; j++) {
+        int total = forward[j] + backward[n - j];
+        if (total > best) {
+            best = total;
+            split = j;
         }
     }
     
-    reverse(positions.begin(), positions.end());
-    return positions;
+    hirschbergLCS(str1, str2, r0, mid, c0, c0 + split, positions);
+    hirschbergLCS(str1, str2, mid, r1, c0 + split, c1, positions);
 }
 
 int GreedyEditDistance::calculateOperationCost(OperationType type, char from_char, char to_char) {
@@ -333,4 +528,72 @@ string GreedyEditDistance::operationToString(const EditOperation& op) {
         default:
             return "Unknown";
     }
+}
+
+Cigar GreedyEditDistance::toCigar(const vector<EditOperation>& operations, const string& source) {
+    Cigar cigar;
+    int cursor = 0;  // 下一个尚未对齐的源字符
+    int output = 0;  // 工作串中已对齐部分的长度
+    
+    for (const auto& op : operations) {
+        // 操作位置之前未列出的字符视为匹配
+        int gap = max(0, min(op.position - output, (int)source.length() - cursor));
+        cigar.append(Cigar::MATCH, gap);
+        cursor += gap;
+        output += gap;
+        
+        switch (op.type) {
+            case MATCH:
+                cigar.append(Cigar::MATCH);
+                cursor++; output++;
+                break;
+            case REPLACE:
+                cigar.append(Cigar::REPLACE);
+                cursor++; output++;
+                break;
+            case DELETE:
+                cigar.append(Cigar::DELETE);
+                cursor++;
+                break;
+            case INSERT:
+                cigar.append(Cigar::INSERT);
+                output++;
+                break;
+        }
+    }
+    cigar.append(Cigar::MATCH, max(0, (int)source.length() - cursor));
+    return cigar;
+}
+
+vector<GreedyEditDistance::EditOperation> GreedyEditDistance::fromCigar(
+    const Cigar& cigar, const string& source, const string& target) {
+    
+    vector<EditOperation> operations;
+    operations.reserve(cigar.sourceLength() + cigar.targetLength());
+    
+    // 从左到右执行时，工作串中的位置等于已输出的目标字符数
+    int i = 0, j = 0;
+    for (const auto& run : cigar.getRuns()) {
+        for (int k = 0; k < run.length; k++) {
+            switch (run.op) {
+                case Cigar::MATCH:
+                    operations.push_back(EditOperation(MATCH, j, source[i], target[j]));
+                    i++; j++;
+                    break;
+                case Cigar::REPLACE:
+                    operations.push_back(EditOperation(REPLACE, j, source[i], target[j]));
+                    i++; j++;
+                    break;
+                case Cigar::DELETE:
+                    operations.push_back(EditOperation(DELETE, j, source[i], '\0'));
+                    i++;
+                    break;
+                case Cigar::INSERT:
+                    operations.push_back(EditOperation(INSERT, j, '\0', target[j]));
+                    j++;
+                    break;
+            }
+        }
+    }
+    return operations;
 }
\ No newline at end of file
@@ -3,7 +3,8 @@
 
 #include <string>
 #include <vector>
-#include <map>
+#include <array>
+#include "cigar.h"
 
 /**
  * 基于贪心策略的编辑距离算法实现
@@ -62,19 +63,69 @@ public:
      * 快速近似算法 - 仅做简单的前缀后缀匹配
      */
     static int quickApproximation(const std::string& source, const std::string& target);
+    
+    /**
+     * 启发式上界 - 与heuristicGreedy的distance相同，但不构造操作序列
+     * 去掉公共前后缀后，中间部分逐位替换并补齐长度差，结果不小于真实编辑距离
+     * 时间复杂度: O(max(m,n))
+     */
+    static int heuristicUpperBound(const std::string& source, const std::string& target);
+    
+    /**
+     * 直接输出游程编码的操作序列，不构造逐字符的操作数组
+     * basicGreedyCigar对应basicGreedyEditDistance与positionBasedGreedy（两者的对齐相同），
+     * heuristicGreedyCigar对应heuristicGreedy；frequencyBasedCigar对应frequencyBasedGreedy，
+     * 对齐的目标是其final_string（保留的字符依次匹配，新增字符追加在末尾）
+     */
+    static Cigar basicGreedyCigar(const std::string& source, const std::string& target);
+    static Cigar heuristicGreedyCigar(const std::string& source, const std::string& target);
+    static Cigar frequencyBasedCigar(const std::string& source, const std::string& target);
 
 public:
-    // 计算字符频率
-    static std::map<char, int> calculateFrequency(const std::string& str);
+    // 计算字符频率，下标为(unsigned char)字符
+    static std::array<int, 256> calculateFrequency(const std::string& str);
     
-    // 寻找最长公共子序列
+    /**
+     * 寻找最长公共子序列，返回各匹配字符在两个串中的位置
+     * Hirschberg分治，每层用位并行LCS计算中间行，小规模子问题直接用DP表
+     * 时间复杂度: O(m*n/w*log(m))
+     * 空间复杂度: O(m+n)
+     */
     static std::vector<std::pair<int, int>> findLCS(const std::string& str1, const std::string& str2);
     
+    /**
+     * 位并行LCS长度（Allison-Dix/Hyyrö）- 以str2为位向量，逐个读入str1的字符
+     * V' = (V + (V & M)) | (V & ~M)，V中0的个数即为LCS长度
+     * 时间复杂度: O(m*n/w)
+     * 空间复杂度: O(σ*n/w)
+     */
+    static int lcsLength(const std::string& str1, const std::string& str2);
+    
     // 计算操作代价
     static int calculateOperationCost(OperationType type, char from_char, char to_char);
     
     // 操作转字符串
     static std::string operationToString(const EditOperation& op);
+    
+    // 操作序列转为游程编码：要求操作按位置从左到右执行（除frequencyBasedGreedy外的贪心算法），
+    // 未列出的位置视为匹配
+    static Cigar toCigar(const std::vector<EditOperation>& operations, const std::string& source);
+    
+    // 游程编码还原为从左到右执行的操作序列，target为对齐的目标串
+    static std::vector<EditOperation> fromCigar(const Cigar& cigar,
+                                                const std::string& source, const std::string& target);
+
+private:
+    // Hirschberg分治中改用DP表的子问题规模
+    static const int LCS_TABLE_CELL_LIMIT = 4096;
+    
+    // row[j] = LCS(str1, str2前j个字符)，j = 0..n
+    static std::vector<int> lcsRow(const std::string& str1, const std::string& str2);
+    
+    // 递归求str1[r0, r1)与str2[c0, c1)的LCS，位置追加到positions
+    static void hirschbergLCS(const std::string& str1, const std::string& str2,
+                              int r0, int r1, int c0, int c1,
+                              std::vector<std::pair<int, int>>& positions);
 };
 
 #endif // GREEDY_EDIT_DISTANCE_H
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "levenshtein_automaton.h"
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+
+using namespace std;
+
+DictionaryTrie::DictionaryTrie() {
+    nodes.emplace_back('\0');
+}
+
+void DictionaryTrie::build(const vector<string>& word_list) {
+    nodes.clear();
+    words.clear();
+    nodes.emplace_back('\0');
+    for (const auto& word : word_list) {
+        insert(word);
+    }
+}
+
+void DictionaryTrie::insert(const string& word) {
+    int current = 0;
+    for (char c : word) {
+        int child = nodes[current].first_child;
+        while (child >= 0 && nodes[child].label != c) {
+            child = nodes[child].next_sibling;
+        }
+        if (child < 0) {
+            child = nodes.size();
+            nodes.emplace_back(c);
+            nodes[child].next_sibling = nodes[current].first_child;
+            nodes[current].first_child = child;
+        }
+        current = child;
+    }
+    if (nodes[current].word_index < 0) {
+        nodes[current].word_index = words.size();
+        words.push_back(word);
+    }
+}
+
+int DictionaryTrie::size() const {
+    return words.size();
+}
+
+LevenshteinAutomaton::LevenshteinAutomaton(const string& query_word, int max_distance)
+    : query(query_word), k(max_distance), width(2 * max_distance + 1) {
+    
+    if (k < 0 || k > MAX_DISTANCE) {
+        throw invalid_argument("LevenshteinAutomaton: k must be in [0, 3]");
+    }
+    
+    // 状态0为死状态（所有格子都是k+1），状态1为初始状态：D[0][j] = j，j < 0的格子为k+1
+    uint32_t dead = 0;
+    uint32_t initial = 0;
+    for (int d = 0; d < width; d++) {
+        int j = d - k;
+        dead |= (uint32_t)(k + 1) << (3 * d);
+        initial |= (uint32_t)(j < 0 ? k + 1 : min(j, k + 1)) << (3 * d);
+    }
+    internState(dead);
+    internState(initial);
+}
+
+int LevenshteinAutomaton::start() const {
+    return 1;
+}
+
+int LevenshteinAutomaton::internState(uint32_t packed) {
+    auto it = state_ids.find(packed);
+    if (it != state_ids.end()) {
+        return it->second;
+    }
+    
+    int id = cells.size();
+    uint32_t mask = 0;
+    for (int d = 0; d < width; d++) {
+        if ((int)((packed >> (3 * d)) & 7) <= k) {
+            mask |= 1U << d;
+        }
+    }
+    cells.push_back(packed);
+    alive.push_back(mask);
+    state_ids[packed] = id;
+    transitions.resize(cells.size() << width, -1);
+    return id;
+}
+
+int LevenshteinAutomaton::cell(int state, int d) const {
+    return (cells[state] >> (3 * d)) & 7;
+}
+
+uint32_t LevenshteinAutomaton::characteristic(int row, char c) const {
+    uint32_t bits = 0;
+    int n = query.length();
+    for (int d = 0; d < width; d++) {
+        int position = row - k + d;
+        if (position >= 0 && position < n && query[position] == c) {
+            bits |= 1U << d;
+        }
+    }
+    return bits;
+}
+
+uint32_t LevenshteinAutomaton::validMask(int row) const {
+    // 第d格对应列row-k+d，列号不超过n的格子才属于查询串范围
+    int last = (int)query.length() - row + k;
+    if (last < 0) return 0;
+    if (last >= width - 1) return (1U << width) - 1;
+    return (1U << (last + 1)) - 1;
+}
+
+int LevenshteinAutomaton::step(int state, int row, char c) {
+    uint32_t chi = characteristic(row, c);
+    size_t slot = ((size_t)state << width) | chi;
+    if (transitions[slot] >= 0) {
+        return transitions[slot];
+    }
+    
+    // D[i+1][j] = min(D[i][j-1] + 代价, D[i][j] + 1, D[i+1][j-1] + 1)，新第d格对应旧的第d格（对角）和第d+1格（竖直）
+    uint32_t packed = 0;
+    int left = k + 1;
+    for (int d = 0; d < width; d++) {
+        int value = cell(state, d) + ((chi >> d) & 1 ? 0 : 1);
+        if (d + 1 < width) {
+            value = min(value, cell(state, d + 1) + 1);
+        }
+        value = min(value, left + 1);
+        value = min(value, k + 1);
+        packed |= (uint32_t)value << (3 * d);
+        left = value;
+    }
+    
+    int next = internState(packed);
+    transitions[slot] = next;
+    return next;
+}
+
+bool LevenshteinAutomaton::canMatch(int state, int row) const {
+    return (alive[state] & validMask(row)) != 0;
+}
+
+int LevenshteinAutomaton::distance(int state, int row) const {
+    int d = (int)query.length() - row + k;
+    if (d < 0 || d >= width) {
+        return k + 1;
+    }
+    return cell(state, d);
+}
+
+bool LevenshteinAutomaton::matches(const string& word) {
+    int state = start();
+    for (size_t i = 0; i < word.length(); i++) {
+        if (!canMatch(state, i)) {
+            return false;
+        }
+        state = step(state, i, word[i]);
+    }
+    return distance(state, word.length()) <= k;
+}
+
+LevenshteinAutomaton::MatchResult LevenshteinAutomaton::search(const DictionaryTrie& dictionary) {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    MatchResult result;
+    result.edges_visited = 0;
+    
+    // (字典树节点, 深度, 自动机状态)
+    struct Frame {
+        int node;
+        int depth;
+        int state;
+    };
+    vector<Frame> stack;
+    stack.push_back({0, 0, start()});
+    
+    while (!stack.empty()) {
+        Frame frame = stack.back();
+        stack.pop_back();
+        
+        const DictionaryTrie::Node& node = dictionary.nodes[frame.node];
+        if (node.word_index >= 0) {
+            int dist = distance(frame.state, frame.depth);
+            if (dist <= k) {
+                result.matches.emplace_back(dictionary.words[node.word_index], dist);
+            }
+        }
+        
+        for (int child = node.first_child; child >= 0; child = dictionary.nodes[child].next_sibling) {
+            result.edges_visited++;
+            int next = step(frame.state, frame.depth, dictionary.nodes[child].label);
+            if (canMatch(next, frame.depth + 1)) {
+                stack.push_back({child, frame.depth + 1, next});
+            }
+        }
+    }
+    
+    sort(result.matches.begin(), result.matches.end(),
+         [](const pair<string, int>& a, const pair<string, int>& b) {
+             return a.second != b.second ? a.second < b.second : a.first < b.first;
+         });
+    result.automaton_states = cells.size();
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    result.computation_time = chrono::duration<double, milli>(end_time - start_time).count();
+    
+    return result;
+}
@@ -0,0 +1,118 @@
+#ifndef LEVENSHTEIN_AUTOMATON_H
+#define LEVENSHTEIN_AUTOMATON_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * 字典树 - 节点连续存放，子节点以(首子节点, 兄弟节点)链表组织
+ */
+class DictionaryTrie {
+public:
+    DictionaryTrie();
+    
+    /**
+     * 由单词列表建树，重复单词只保留一个
+     */
+    void build(const std::vector<std::string>& words);
+    
+    void insert(const std::string& word);
+    
+    int size() const;
+
+private:
+    friend class LevenshteinAutomaton;
+    
+    struct Node {
+        char label;        // 进入该节点的边上的字符
+        int first_child;   // 第一个子节点，-1表示没有
+        int next_sibling;  // 下一个兄弟节点，-1表示没有
+        int word_index;    // 以该节点结尾的单词下标，-1表示不是单词结尾
+        
+        Node(char c) : label(c), first_child(-1), next_sibling(-1), word_index(-1) {}
+    };
+    
+    std::vector<Node> nodes;
+    std::vector<std::string> words;
+};
+
+/**
+ * Levenshtein自动机（k <= 3）
+ * 读入单词第i个字符后的状态是DP第i行在对角带[i-k, i+k]内的2k+1个值（截断到k+1），
+ * 转移只取决于当前状态和特征向量（查询串在带内各位置是否等于读入的字符），
+ * 与查询串本身无关，因此状态和转移表是通用的，按需构造
+ */
+class LevenshteinAutomaton {
+public:
+    // 字典匹配结果
+    struct MatchResult {
+        std::vector<std::pair<std::string, int>> matches; // 命中的单词及距离，按距离排序
+        int edges_visited;                                // 访问的字典树边数
+        int automaton_states;                             // 已构造的自动机状态数
+        double computation_time;                          // 计算时间(ms)
+    };
+
+public:
+    static const int MAX_DISTANCE = 3;
+    
+    /**
+     * 为查询串构造自动机，k不在[0, MAX_DISTANCE]内时抛出std::invalid_argument
+     */
+    LevenshteinAutomaton(const std::string& query, int k);
+    
+    // 初始状态（已读入0个字符）
+    int start() const;
+    
+    /**
+     * 在已读入row个字符的状态下读入字符c，返回新状态
+     */
+    int step(int state, int row, char c);
+    
+    /**
+     * 已读入row个字符时是否还可能匹配（存在查询串范围内不超过k的值）
+     */
+    bool canMatch(int state, int row) const;
+    
+    /**
+     * 读入的单词长度为row时与查询串的编辑距离，超过k时返回k+1
+     */
+    int distance(int state, int row) const;
+    
+    /**
+     * 单词是否与查询串的编辑距离不超过k
+     */
+    bool matches(const std::string& word);
+    
+    /**
+     * 与字典树求交 - 深度优先遍历，每条边至多访问一次，死状态所在的子树整棵跳过
+     * 时间复杂度: O(访问的边数*k)
+     */
+    MatchResult search(const DictionaryTrie& dictionary);
+
+private:
+    std::string query;
+    int k;
+    int width;  // 带宽2k+1
+    
+    // 状态按每格3位打包，cells[state]为打包值，alive[state]的第d位表示第d格不超过k
+    std::vector<uint32_t> cells;
+    std::vector<uint32_t> alive;
+    std::unordered_map<uint32_t, int> state_ids;
+    
+    // 转移表：transitions[state << width | 特征向量]，-1表示尚未构造
+    std::vector<int> transitions;
+    
+    int internState(uint32_t packed);
+    int cell(int state, int d) const;
+    
+    // 第row行读入字符c的特征向量：第d位表示query[row-k+d] == c
+    uint32_t characteristic(int row, char c) const;
+    
+    // 带内位于查询串范围（列不超过query长度）的格子掩码
+    uint32_t validMask(int row) const;
+};
+
+#endif // LEVENSHTEIN_AUTOMATON_H
@@ -0,0 +1,137 @@
+#include "qgram_index.h"
+#include "dynamic_programming.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+QGramIndex::QGramIndex(int gram_length) : q(max(1, gram_length)) {
+    if (q > MAX_Q) {
+        q = MAX_Q;
+    }
+}
+
+void QGramIndex::build(const vector<string>& record_list) {
+    clear();
+    records.reserve(record_list.size());
+    for (const auto& record : record_list) {
+        add(record);
+    }
+}
+
+unordered_map<uint64_t, int> QGramIndex::countGrams(const string& text) const {
+    unordered_map<uint64_t, int> counts;
+    uint64_t mask = q == 8 ? ~0ULL : (1ULL << (8 * q)) - 1;
+    uint64_t gram = 0;
+    for (size_t i = 0; i < text.length(); i++) {
+        gram = ((gram << 8) | (unsigned char)text[i]) & mask;
+        if ((int)i + 1 >= q) {
+            counts[gram]++;
+        }
+    }
+    return counts;
+}
+
+int QGramIndex::add(const string& record) {
+    int id = records.size();
+    records.push_back(record);
+    
+    for (const auto& entry : countGrams(record)) {
+        postings[entry.first].emplace_back(id, entry.second);
+    }
+    
+    if (length_buckets.size() <= record.length()) {
+        length_buckets.resize(record.length() + 1);
+    }
+    length_buckets[record.length()].push_back(id);
+    
+    return id;
+}
+
+QGramIndex::QueryResult QGramIndex::query(const string& text, int k) const {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    QueryResult result;
+    result.length_candidates = 0;
+    result.candidates_verified = 0;
+    
+    int n = text.length();
+    vector<int> candidates;
+    
+    if (k >= 0) {
+        // 共享q-gram数（多重集交集大小）
+        unordered_map<int, int> shared;
+        for (const auto& entry : countGrams(text)) {
+            auto it = postings.find(entry.first);
+            if (it == postings.end()) continue;
+            for (const auto& posting : it->second) {
+                shared[posting.first] += min(entry.second, posting.second);
+            }
+        }
+        
+        // 阈值不大于0时引理无法过滤，只有这些长度需要扫描整个长度桶
+        int min_length = max(0, n - k);
+        int max_length = min((int)length_buckets.size() - 1, n + k);
+        for (int length = min_length; length <= max_length; length++) {
+            const vector<int>& bucket = length_buckets[length];
+            result.length_candidates += bucket.size();
+            
+            int threshold = max(n, length) - q + 1 - k * q;
+            if (threshold <= 0) {
+                candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+            }
+        }
+        
+        // 其余长度的候选只来自倒排表，与长度桶大小无关
+        for (const auto& entry : shared) {
+            int length = records[entry.first].length();
+            if (length < min_length || length > max_length) continue;
+            
+            int threshold = max(n, length) - q + 1 - k * q;
+            if (threshold > 0 && entry.second >= threshold) {
+                candidates.push_back(entry.first);
+            }
+        }
+    }
+    
+    for (int id : candidates) {
+        result.candidates_verified++;
+        int distance = DynamicProgrammingEditDistance::bitParallelBoundedEditDistance(text, records[id], k);
+        if (distance <= k) {
+            result.matches.emplace_back(id, distance);
+        }
+    }
+    
+    sort(result.matches.begin(), result.matches.end(),
+         [](const pair<int, int>& a, const pair<int, int>& b) {
+             return a.second != b.second ? a.second < b.second : a.first < b.first;
+         });
+    result.selectivity = records.empty() ? 0.0 : (double)result.candidates_verified / records.size();
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    result.computation_time = chrono::duration<double, milli>(end_time - start_time).count();
+    
+    return result;
+}
+
+const string& QGramIndex::record(int id) const {
+    return records[id];
+}
+
+int QGramIndex::size() const {
+    return records.size();
+}
+
+int QGramIndex::getQ() const {
+    return q;
+}
+
+int QGramIndex::gramCount() const {
+    return postings.size();
+}
+
+void QGramIndex::clear() {
+    records.clear();
+    postings.clear();
+    length_buckets.clear();
+}
@@ -0,0 +1,74 @@
+#ifndef QGRAM_INDEX_H
+#define QGRAM_INDEX_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * q-gram倒排索引 - 适用于较长的记录（商品标题、地址等）
+ * q-gram计数引理：编辑距离不超过k的两个串至少共享max(|s|,|t|)-q+1-k*q个q-gram，
+ * 共享数不足的记录直接过滤，剩下的候选再用有界DP验证
+ */
+class QGramIndex {
+public:
+    // 查询结果
+    struct QueryResult {
+        std::vector<std::pair<int, int>> matches; // (记录下标, 距离)，按距离排序
+        int length_candidates;                    // 通过长度过滤的记录数
+        int candidates_verified;                  // 通过计数过滤、用DP验证的记录数
+        double selectivity;                       // 验证数占索引记录数的比例
+        double computation_time;                  // 计算时间(ms)
+    };
+
+public:
+    static const int MAX_Q = 8;
+    
+    /**
+     * q取值范围为[1, MAX_Q]，超出时截断到该范围；每个q-gram打包为一个64位整数
+     */
+    explicit QGramIndex(int q = 3);
+    
+    /**
+     * 批量建索引 - 清空已有内容后依次加入，记录下标即在records中的位置
+     */
+    void build(const std::vector<std::string>& records);
+    
+    /**
+     * 加入一条记录，返回其下标
+     */
+    int add(const std::string& record);
+    
+    /**
+     * 查询与text编辑距离不超过k的所有记录
+     */
+    QueryResult query(const std::string& text, int k) const;
+    
+    const std::string& record(int id) const;
+    
+    int size() const;
+    
+    int getQ() const;
+    
+    // 不同q-gram的数量
+    int gramCount() const;
+    
+    void clear();
+
+private:
+    int q;
+    std::vector<std::string> records;
+    
+    // q-gram -> (记录下标, 该q-gram在记录中的出现次数)
+    std::unordered_map<uint64_t, std::vector<std::pair<int, int>>> postings;
+    
+    // 按长度分组的记录下标，用于长度过滤以及计数引理无法过滤的短记录
+    std::vector<std::vector<int>> length_buckets;
+    
+    // 统计text中各q-gram的出现次数
+    std::unordered_map<uint64_t, int> countGrams(const std::string& text) const;
+};
+
+#endif // QGRAM_INDEX_H
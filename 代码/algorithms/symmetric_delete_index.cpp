@@ -0,0 +1,137 @@
+#include "symmetric_delete_index.h"
+#include "bfs_edit_distance.h"
+#include "dynamic_programming.h"
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_set>
+#include <chrono>
+
+using namespace std;
+
+SymmetricDeleteIndex::SymmetricDeleteIndex(int max_distance, int prefix_length)
+    : max_distance(max(0, max_distance)), prefix_length(max(1, prefix_length)) {}
+
+void SymmetricDeleteIndex::build(const vector<string>& word_list) {
+    clear();
+    words.reserve(word_list.size());
+    for (const auto& word : word_list) {
+        insert(word);
+    }
+}
+
+bool SymmetricDeleteIndex::insert(const string& word) {
+    if (word_ids.count(word)) {
+        return false;
+    }
+    
+    int id = words.size();
+    words.push_back(word);
+    word_ids[word] = id;
+    
+    for (const auto& key : deletionKeys(word, max_distance)) {
+        deletes[key].push_back(id);
+    }
+    return true;
+}
+
+vector<string> SymmetricDeleteIndex::deletionKeys(const string& word, int k) const {
+    // 删除后的前prefix_length个字符只来自原串的前prefix_length+k个字符
+    vector<string> level(1, word.substr(0, prefix_length + k));
+    unordered_set<string> seen(level.begin(), level.end());
+    unordered_set<string> keys;
+    keys.insert(level[0].substr(0, prefix_length));
+    
+    vector<string> next_level;
+    for (int depth = 0; depth < k && !level.empty(); depth++) {
+        next_level.clear();
+        for (const auto& current : level) {
+            vector<string> deletions;
+            BFSEditDistance::generateDeletions(current, deletions);
+            for (auto& next : deletions) {
+                if (seen.insert(next).second) {
+                    keys.insert(next.substr(0, prefix_length));
+                    next_level.push_back(next);
+                }
+            }
+        }
+        level.swap(next_level);
+    }
+    
+    return vector<string>(keys.begin(), keys.end());
+}
+
+SymmetricDeleteIndex::QueryResult SymmetricDeleteIndex::query(const string& word, int k) const {
+    auto start_time = chrono::high_resolution_clock::now();
+    
+    QueryResult result;
+    result.deletions_generated = 0;
+    result.candidates_verified = 0;
+    
+    if (k >= 0) {
+        k = min(k, max_distance);
+        vector<string> keys = deletionKeys(word, k);
+        result.deletions_generated = keys.size();
+        
+        // 同一单词可能被多个删除键命中，先收集下标再去重
+        vector<int> hits;
+        for (const auto& key : keys) {
+            auto it = deletes.find(key);
+            if (it != deletes.end()) {
+                hits.insert(hits.end(), it->second.begin(), it->second.end());
+            }
+        }
+        sort(hits.begin(), hits.end());
+        hits.erase(unique(hits.begin(), hits.end()), hits.end());
+        
+        for (int id : hits) {
+            const string& candidate = words[id];
+            if (abs((int)candidate.length() - (int)word.length()) > k) continue;
+            
+            result.candidates_verified++;
+            int distance = DynamicProgrammingEditDistance::bitParallelBoundedEditDistance(word, candidate, k);
+            if (distance <= k) {
+                result.matches.emplace_back(candidate, distance);
+            }
+        }
+    }
+    
+    sort(result.matches.begin(), result.matches.end(),
+         [](const pair<string, int>& a, const pair<string, int>& b) {
+             return a.second != b.second ? a.second < b.second : a.first < b.first;
+         });
+    
+    auto end_time = chrono::high_resolution_clock::now();
+    result.computation_time = chrono::duration<double, milli>(end_time - start_time).count();
+    
+    return result;
+}
+
+int SymmetricDeleteIndex::size() const {
+    return words.size();
+}
+
+int SymmetricDeleteIndex::keyCount() const {
+    return deletes.size();
+}
+
+long long SymmetricDeleteIndex::entryCount() const {
+    long long total = 0;
+    for (const auto& entry : deletes) {
+        total += entry.second.size();
+    }
+    return total;
+}
+
+int SymmetricDeleteIndex::maxDistance() const {
+    return max_distance;
+}
+
+int SymmetricDeleteIndex::prefixLength() const {
+    return prefix_length;
+}
+
+void SymmetricDeleteIndex::clear() {
+    words.clear();
+    word_ids.clear();
+    deletes.clear();
+}
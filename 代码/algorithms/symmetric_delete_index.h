@@ -0,0 +1,76 @@
+#ifndef SYMMETRIC_DELETE_INDEX_H
+#define SYMMETRIC_DELETE_INDEX_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+/**
+ * 对称删除索引（SymSpell风格）
+ * 若编辑距离不超过k，两个字符串各删除不超过k个字符后可以相同。
+ * 建索引时预先生成每个单词的删除邻域，查询时只生成查询串自己的删除邻域，
+ * 命中的单词再用有界DP验证，以内存换取查询速度
+ */
+class SymmetricDeleteIndex {
+public:
+    // 查询结果
+    struct QueryResult {
+        std::vector<std::pair<std::string, int>> matches; // 命中的单词及距离，按距离排序
+        int deletions_generated;                          // 查询串生成的删除键数
+        int candidates_verified;                          // 用DP验证的候选数
+        double computation_time;                          // 计算时间(ms)
+    };
+
+public:
+    /**
+     * max_distance为支持的最大编辑距离，prefix_length为参与建索引的前缀长度。
+     * 删除键只保留前prefix_length个字符，只需对前prefix_length+max_distance个字符做删除，
+     * 索引大小与单词长度无关
+     */
+    explicit SymmetricDeleteIndex(int max_distance = 2, int prefix_length = 7);
+    
+    /**
+     * 批量建索引 - 清空已有内容后依次插入，重复单词只保留一个
+     */
+    void build(const std::vector<std::string>& words);
+    
+    /**
+     * 插入单词，已存在时返回false
+     */
+    bool insert(const std::string& word);
+    
+    /**
+     * 查询与word编辑距离不超过k的所有单词，k取值超过max_distance时按max_distance处理
+     */
+    QueryResult query(const std::string& word, int k) const;
+    
+    int size() const;
+    
+    // 删除键的数量
+    int keyCount() const;
+    
+    // 所有键对应的单词下标总数
+    long long entryCount() const;
+    
+    int maxDistance() const;
+    
+    int prefixLength() const;
+    
+    void clear();
+
+private:
+    int max_distance;
+    int prefix_length;
+    
+    std::vector<std::string> words;
+    std::unordered_map<std::string, int> word_ids;
+    
+    // 删除键 -> 单词下标列表
+    std::unordered_map<std::string, std::vector<int>> deletes;
+    
+    // 生成word删除不超过k个字符后的所有键（截断到prefix_length，已去重）
+    std::vector<std::string> deletionKeys(const std::string& word, int k) const;
+};
+
+#endif // SYMMETRIC_DELETE_INDEX_H
@@ -3,6 +3,14 @@
 #include "algorithms/dynamic_programming.h"
 #include "algorithms/bfs_edit_distance.h"
 #include "algorithms/greedy_edit_distance.h"
+#include "algorithms/bk_tree.h"
+#include "algorithms/levenshtein_automaton.h"
+#include "algorithms/symmetric_delete_index.h"
+#include "algorithms/qgram_index.h"
+#include "algorithms/filter_cascade.h"
+#include "algorithms/edit_script.h"
+#include "algorithms/anytime_edit_distance.h"
+#include "algorithms/edit_distance_engine.h"
 #include "utils/performance_timer.h"
 #include "utils/test_data.h"
 
@@ -24,9 +32,13 @@ void testBasicFunctionality() {
         auto complete_result = DynamicProgrammingEditDistance::completeEditDistance(
             test_case.str1, test_case.str2);
         
+        int bit_parallel_result = DynamicProgrammingEditDistance::bitParallelEditDistance(
+            test_case.str1, test_case.str2);
+        
         cout << "Calculated Edit Distance: " << basic_result << endl;
         cout << "Expected Edit Distance: " << test_case.expected_distance << endl;
         cout << "Result: " << (basic_result == test_case.expected_distance ? "[PASS]" : "[FAIL]") << endl;
+        cout << "Bit-Parallel Consistency: " << (bit_parallel_result == basic_result ? "[PASS]" : "[FAIL]") << endl;
         cout << "Computation Time: " << fixed << setprecision(3) << complete_result.computation_time << " ms" << endl;
         
         if (test_case.str1.length() <= 10 && test_case.str2.length() <= 10) {
@@ -38,15 +50,20 @@ void testBasicFunctionality() {
             }
             cout << endl;
         }
+        
+        // 游程编码的操作序列
+        Cigar cigar = DynamicProgrammingEditDistance::cigarEditDistance(test_case.str1, test_case.str2);
+        cout << "CIGAR: " << cigar.toString() << endl;
     }
 }
 
 void testBFSFunctionality() {
     cout << "\n========== BFS Algorithm Test (Limited) ==========" << endl;
     
-    // 仅保留一个简单测试用例证明BFS可以运行
+    // 邻居只写入目标串中的字符，基础BFS也可以处理单词长度的输入
     vector<pair<string, string>> bfs_test_cases = {
-        {"cat", "bat"}
+        {"cat", "bat"},
+        {"kitten", "sitting"}
     };
     
     for (const auto& test_case : bfs_test_cases) {
@@ -60,6 +77,39 @@ void testBFSFunctionality() {
         
         cout << "Note: BFS shows exponential state space growth - see detailed analysis in report" << endl;
     }
+    
+    // 完整BFS只保存最短路径DAG，搜索结束后再展开全部最优路径
+    auto complete_result = BFSEditDistance::completeBFSEditDistance("flaw", "lawn");
+    cout << "\nAll Optimal Paths \"flaw\" -> \"lawn\" (distance " << complete_result.min_distance
+         << ", nodes " << complete_result.nodes_explored << "):" << endl;
+    for (const auto& path : complete_result.all_paths) {
+        cout << "  ";
+        for (size_t i = 0; i < path.size(); i++) {
+            cout << (i > 0 ? " -> " : "") << path[i];
+        }
+        cout << endl;
+    }
+    
+    // 状态打包为64位键后，双向BFS可以处理常见单词长度；字符集不限于小写字母
+    vector<pair<string, string>> word_cases = {
+        {"kitten", "sitting"},
+        {"saturday", "sunday"},
+        {"New York", "new-york"}
+    };
+    
+    for (const auto& test_case : word_cases) {
+        auto result = BFSEditDistance::bidirectionalBFS(test_case.first, test_case.second);
+        int dp_distance = DynamicProgrammingEditDistance::basicEditDistance(test_case.first, test_case.second);
+        cout << "\nBidirectional BFS: \"" << test_case.first << "\" -> \"" << test_case.second << "\": "
+             << result.min_distance << ", nodes " << result.nodes_explored
+             << ", time " << fixed << setprecision(3) << result.computation_time << " ms "
+             << (result.min_distance == dp_distance ? "[PASS]" : "[FAIL]") << endl;
+        
+        auto astar_result = BFSEditDistance::optimizedBFSEditDistance(test_case.first, test_case.second);
+        cout << "A* Search: " << astar_result.min_distance << ", nodes " << astar_result.nodes_explored
+             << ", time " << fixed << setprecision(3) << astar_result.computation_time << " ms "
+             << (astar_result.min_distance == dp_distance ? "[PASS]" : "[FAIL]") << endl;
+    }
 }
 
 void testGreedyAlgorithms() {
@@ -108,6 +158,12 @@ void testGreedyAlgorithms() {
             cout << "Quick Approximation: " << fixed << setprecision(2) << quick_ratio << endl;
         }
         
+        // 用编辑脚本引擎重放DP操作序列，结果应为目标串
+        auto dp_complete = DynamicProgrammingEditDistance::completeEditDistance(test_case.first, test_case.second);
+        bool replay_ok = EditScript::apply(test_case.first, dp_complete.operations) == test_case.second &&
+                         EditScript::apply(test_case.first, basic_greedy.operations) == basic_greedy.final_string;
+        cout << "Edit Script Replay: " << (replay_ok ? "[PASS]" : "[FAIL]") << endl;
+        
         // 显示操作序列（仅对较短字符串）
         if (test_case.first.length() <= 8) {
             cout << "Basic Greedy Operations: ";
@@ -177,6 +233,12 @@ void testPerformance() {
     }
     double dp_time = timer.stop();
     
+    timer.start();
+    for (const auto& pair : test_data) {
+        DynamicProgrammingEditDistance::blockedBitParallelEditDistance(pair.first, pair.second);
+    }
+    double bit_parallel_time = timer.stop();
+    
     timer.start();
     for (const auto& pair : test_data) {
         GreedyEditDistance::basicGreedyEditDistance(pair.first, pair.second);
@@ -189,13 +251,34 @@ void testPerformance() {
     }
     double quick_time = timer.stop();
     
+    // 相似长字符串：差异很少时对角线转移算法只需处理少数几条对角线
+    string base_text;
+    for (int i = 0; i < 20; i++) {
+        base_text += TestDataGenerator::generateRandomString(500);
+    }
+    auto similar_pair = TestDataGenerator::generateSimilarStrings(base_text, 0.99);
+    
+    timer.start();
+    int similar_dp = DynamicProgrammingEditDistance::blockedBitParallelEditDistance(similar_pair.first, similar_pair.second);
+    double similar_bit_parallel_time = timer.stop();
+    
+    timer.start();
+    int similar_diagonal = DynamicProgrammingEditDistance::diagonalTransitionEditDistance(similar_pair.first, similar_pair.second);
+    double diagonal_time = timer.stop();
+    
     cout << "\nPerformance Results:" << endl;
     cout << "Dynamic Programming: " << fixed << setprecision(3) << dp_time << " ms" << endl;
+    cout << "Blocked Bit-Parallel DP: " << fixed << setprecision(3) << bit_parallel_time << " ms" << endl;
     cout << "Greedy Algorithm: " << fixed << setprecision(3) << greedy_time << " ms" << endl;
     cout << "Quick Approximation: " << fixed << setprecision(3) << quick_time << " ms" << endl;
+    cout << "Similar Strings (length " << similar_pair.first.length() << ", distance " << similar_diagonal << "):" << endl;
+    cout << "  Blocked Bit-Parallel DP: " << fixed << setprecision(3) << similar_bit_parallel_time << " ms" << endl;
+    cout << "  Diagonal Transition: " << fixed << setprecision(3) << diagonal_time << " ms "
+         << (similar_diagonal == similar_dp ? "[PASS]" : "[FAIL]") << endl;
     
     if (dp_time > 0) {
         cout << "Performance Improvement:" << endl;
+        cout << "Bit-Parallel vs DP: " << fixed << setprecision(2) << dp_time / bit_parallel_time << "x faster" << endl;
         cout << "Greedy vs DP: " << fixed << setprecision(2) << dp_time / greedy_time << "x faster" << endl;
         cout << "Quick vs DP: " << fixed << setprecision(2) << dp_time / quick_time << "x faster" << endl;
     }
@@ -228,6 +311,247 @@ void testBatchProcessing() {
     }
     
     cout << "\nBatch Processing Time: " << fixed << setprecision(3) << batch_time << " ms" << endl;
+    
+    // 带阈值的批量查询：只保留距离不超过2的候选
+    int max_distance = 2;
+    timer.start();
+    auto bounded_results = DynamicProgrammingEditDistance::batchEditDistance(target, candidates, max_distance);
+    double bounded_time = timer.stop();
+    
+    cout << "\nCandidates within distance " << max_distance << ":" << endl;
+    for (const auto& result : bounded_results) {
+        cout << "\"" << result.first << "\": " << result.second << endl;
+    }
+    cout << "Bounded Batch Time: " << fixed << setprecision(3) << bounded_time << " ms" << endl;
+    
+    // 共享前缀批量计算：结果与候选一一对应，应与逐个计算一致
+    timer.start();
+    auto prefix_distances = DynamicProgrammingEditDistance::prefixSharingBatchEditDistance(target, candidates);
+    double prefix_time = timer.stop();
+    
+    bool prefix_consistent = true;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (prefix_distances[i] != DynamicProgrammingEditDistance::basicEditDistance(target, candidates[i])) {
+            prefix_consistent = false;
+        }
+    }
+    cout << "\nPrefix-Sharing Batch Consistency: " << (prefix_consistent ? "[PASS]" : "[FAIL]") << endl;
+    cout << "Prefix-Sharing Batch Time: " << fixed << setprecision(3) << prefix_time << " ms" << endl;
+    
+    // 多线程Top-K查询：结果为候选下标及距离
+    int top_k = 3;
+    timer.start();
+    auto top_results = DynamicProgrammingEditDistance::topKEditDistance(target, candidates, top_k);
+    double top_k_time = timer.stop();
+    
+    cout << "\nTop-" << top_k << " Candidates:" << endl;
+    for (const auto& match : top_results) {
+        cout << "\"" << candidates[match.index] << "\": " << match.distance << endl;
+    }
+    cout << "Top-K Query Time: " << fixed << setprecision(3) << top_k_time << " ms" << endl;
+}
+
+void testBKTree() {
+    cout << "\n========== BK-Tree Index Test ==========" << endl;
+    
+    vector<string> dictionary = {
+        "algorithm", "algorithms", "algorithmic", "logarithm", "arithmetic",
+        "heuristic", "polynomial", "rhythm", "altruism", "allegory"
+    };
+    
+    BKTree tree;
+    tree.build(dictionary);
+    
+    string word = "algoritm";
+    int k = 2;
+    auto result = tree.query(word, k);
+    
+    cout << "Query: \"" << word << "\", k = " << k << endl;
+    for (const auto& match : result.matches) {
+        cout << "\"" << match.first << "\": " << match.second << endl;
+    }
+    cout << "Distance Evaluations: " << result.distance_evaluations << "/" << result.tree_size << endl;
+    cout << "Query Time: " << fixed << setprecision(3) << result.computation_time << " ms" << endl;
+    
+    auto nearest = tree.nearest("polinomal");
+    if (!nearest.matches.empty()) {
+        cout << "Nearest to \"polinomal\": \"" << nearest.matches[0].first << "\" ("
+             << nearest.matches[0].second << "), evaluations: " << nearest.distance_evaluations << endl;
+    }
+}
+
+void testLevenshteinAutomaton() {
+    cout << "\n========== Levenshtein Automaton Test ==========" << endl;
+    
+    vector<string> dictionary = {
+        "algorithm", "algorithms", "algorithmic", "logarithm", "arithmetic",
+        "heuristic", "polynomial", "rhythm", "altruism", "allegory"
+    };
+    
+    DictionaryTrie trie;
+    trie.build(dictionary);
+    
+    string word = "algoritm";
+    int k = 2;
+    LevenshteinAutomaton automaton(word, k);
+    auto result = automaton.search(trie);
+    
+    cout << "Query: \"" << word << "\", k = " << k << endl;
+    for (const auto& match : result.matches) {
+        cout << "\"" << match.first << "\": " << match.second << endl;
+    }
+    int expected = 0;
+    for (const auto& entry : dictionary) {
+        if (DynamicProgrammingEditDistance::basicEditDistance(word, entry) <= k) {
+            expected++;
+        }
+    }
+    bool consistent = expected == (int)result.matches.size();
+    cout << "Automaton Consistency: " << (consistent ? "[PASS]" : "[FAIL]") << endl;
+    cout << "Edges Visited: " << result.edges_visited << ", Automaton States: " << result.automaton_states << endl;
+    cout << "Search Time: " << fixed << setprecision(3) << result.computation_time << " ms" << endl;
+}
+
+void testSymmetricDeleteIndex() {
+    cout << "\n========== Symmetric Delete Index Test ==========" << endl;
+    
+    vector<string> dictionary = {
+        "algorithm", "algorithms", "algorithmic", "logarithm", "arithmetic",
+        "heuristic", "polynomial", "rhythm", "altruism", "allegory"
+    };
+    
+    SymmetricDeleteIndex index(2, 7);
+    index.build(dictionary);
+    
+    string word = "algoritm";
+    int k = 2;
+    auto result = index.query(word, k);
+    
+    cout << "Query: \"" << word << "\", k = " << k << endl;
+    for (const auto& match : result.matches) {
+        cout << "\"" << match.first << "\": " << match.second << endl;
+    }
+    cout << "Index Keys: " << index.keyCount() << ", Entries: " << index.entryCount() << endl;
+    cout << "Query Keys: " << result.deletions_generated << ", Verified: " << result.candidates_verified << endl;
+    cout << "Query Time: " << fixed << setprecision(3) << result.computation_time << " ms" << endl;
+}
+
+void testQGramIndex() {
+    cout << "\n========== Q-Gram Index Test ==========" << endl;
+    
+    vector<string> records = {
+        "wireless bluetooth headphones with noise cancelling",
+        "wireless bluetooth headphone with noise canceling",
+        "wired headphones with microphone",
+        "bluetooth speaker with deep bass",
+        "noise cancelling wireless earbuds"
+    };
+    
+    QGramIndex index(3);
+    index.build(records);
+    
+    string text = "wireless bluetooth headphones with noise canceling";
+    int k = 3;
+    auto result = index.query(text, k);
+    
+    cout << "Query: \"" << text << "\", k = " << k << ", q = " << index.getQ() << endl;
+    for (const auto& match : result.matches) {
+        cout << "\"" << index.record(match.first) << "\": " << match.second << endl;
+    }
+    cout << "Length Candidates: " << result.length_candidates << ", Verified: " << result.candidates_verified
+         << ", Selectivity: " << fixed << setprecision(3) << result.selectivity << endl;
+    cout << "Query Time: " << fixed << setprecision(3) << result.computation_time << " ms" << endl;
+}
+
+void testFilterCascade() {
+    cout << "\n========== Filter Cascade Test ==========" << endl;
+    
+    string target = "algorithm";
+    vector<string> candidates = {
+        "algoritm", "algorythm", "algortihm", "algorithms", 
+        "logarithm", "arithmetic", "heuristic", "polynomial"
+    };
+    
+    FilterCascade cascade(2);
+    int k = 2;
+    auto result = cascade.filter(target, candidates, k);
+    
+    cout << "Candidates within distance " << k << ":" << endl;
+    for (const auto& match : result.matches) {
+        cout << "\"" << candidates[match.first] << "\": " << match.second << endl;
+    }
+    
+    const auto& stats = result.stats;
+    cout << "Eliminated - Length: " << stats.length_eliminated << ", Bag: " << stats.bag_eliminated
+         << ", Q-Gram: " << stats.qgram_eliminated << ", Banded DP: " << stats.banded_eliminated << endl;
+    cout << "Resolved by Bounds: " << stats.resolved_by_bounds << ", Verified: " << stats.verified << endl;
+    cout << "Cascade Time: " << fixed << setprecision(3) << stats.computation_time << " ms" << endl;
+}
+
+void testAnytimeEditDistance() {
+    cout << "\n========== Anytime Edit Distance Test ==========" << endl;
+    
+    string str1 = TestDataGenerator::generateRandomString(5000);
+    string str2 = TestDataGenerator::generateSimilarStrings(str1, 0.9).second;
+    
+    for (double budget_ms : {0.0, 0.2, 1000.0}) {
+        auto result = AnytimeEditDistance::compute(str1, str2, budget_ms);
+        cout << "Budget " << fixed << setprecision(1) << budget_ms << " ms: ["
+             << result.lower_bound << ", " << result.upper_bound << "]"
+             << (result.exact ? " exact" : "") << ", band " << result.band
+             << ", time " << fixed << setprecision(3) << result.computation_time << " ms" << endl;
+    }
+}
+
+void testEditDistanceEngine() {
+    cout << "\n========== Edit Distance Engine Test ==========" << endl;
+    
+    // 代价模型来自本地配置文件，首次运行时校准并保存
+    bool loaded = EditDistanceEngine::loadOrCalibrate();
+    cout << "Cost Profile: " << (loaded ? "loaded from " : "calibrated and saved to ")
+         << EditDistanceEngine::DEFAULT_PROFILE_PATH << endl;
+    
+    // 同一入口按输入规模与所需输出选择算法
+    string long_str = TestDataGenerator::generateRandomString(3000);
+    string long_similar = TestDataGenerator::generateSimilarStrings(long_str, 0.99).second;
+    vector<pair<string, string>> cases = {
+        {"kitten", "sitting"},
+        {"intention", "execution"},
+        {long_str, long_similar},
+        {long_str, TestDataGenerator::generateRandomString(3000)}
+    };
+    
+    for (const auto& test_case : cases) {
+        int expected = DynamicProgrammingEditDistance::bitParallelEditDistance(test_case.first, test_case.second);
+        
+        EditDistanceEngine::Options distance_only;
+        EditDistanceEngine::Options bounded(EditDistanceEngine::BOUNDED_DISTANCE, 100);
+        EditDistanceEngine::Options operations(EditDistanceEngine::OPERATIONS);
+        auto distance_result = EditDistanceEngine::compute(test_case.first, test_case.second, distance_only);
+        auto bounded_result = EditDistanceEngine::compute(test_case.first, test_case.second, bounded);
+        auto operations_result = EditDistanceEngine::compute(test_case.first, test_case.second, operations);
+        
+        bool consistent = distance_result.distance == expected &&
+                          bounded_result.within_bound == (expected <= 100) &&
+                          bounded_result.distance == min(expected, 101) &&
+                          operations_result.distance == expected;
+        cout << "Lengths " << test_case.first.length() << "/" << test_case.second.length()
+             << ": distance " << distance_result.distance
+             << " [" << EditDistanceEngine::kernelName(distance_result.kernel) << ", "
+             << fixed << setprecision(3) << distance_result.computation_time << " ms]"
+             << ", k=100 [" << EditDistanceEngine::kernelName(bounded_result.kernel) << "]"
+             << ", operations [" << EditDistanceEngine::kernelName(operations_result.kernel) << "] "
+             << (consistent ? "[PASS]" : "[FAIL]") << endl;
+    }
+    
+    // 非单位代价
+    EditDistanceEngine::Options weighted;
+    weighted.replace_cost = 2;
+    auto weighted_result = EditDistanceEngine::compute("intention", "execution", weighted);
+    int weighted_expected = DynamicProgrammingEditDistance::weightedEditDistance("intention", "execution", 1, 1, 2);
+    cout << "Weighted (1,1,2): " << weighted_result.distance
+         << " [" << EditDistanceEngine::kernelName(weighted_result.kernel) << "] "
+         << (weighted_result.distance == weighted_expected ? "[PASS]" : "[FAIL]") << endl;
 }
 
 int main() {
@@ -253,6 +577,27 @@ int main() {
         // 批量处理测试
         testBatchProcessing();
         
+        // BK树索引测试
+        testBKTree();
+        
+        // Levenshtein自动机测试
+        testLevenshteinAutomaton();
+        
+        // 对称删除索引测试
+        testSymmetricDeleteIndex();
+        
+        // q-gram倒排索引测试
+        testQGramIndex();
+        
+        // 过滤级联测试
+        testFilterCascade();
+        
+        // 限时编辑距离测试
+        testAnytimeEditDistance();
+        
+        // 统一入口测试
+        testEditDistanceEngine();
+        
         cout << "\nAll tests completed!" << endl;
         
     } catch (const exception& e) {